@@ -1,3 +1,8 @@
+#if defined(__unix__) || defined(__APPLE__)
+#define BUFFER_MMAP
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include <lua.h>
 #include <lauxlib.h>
 
@@ -6,17 +11,81 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <limits.h>
+#include <errno.h>
+#include <stdio.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BUFFER_X86_64
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BUFFER_SHARE
+#endif
+
+#ifdef BUFFER_LUAIO
+#include <luaio.h>
+#else
+typedef struct luaio_Stream luaio_Stream;
+#endif
+
+#ifdef BUFFER_MMAP
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #define BUFFER_MT "Buffer"
+#define LAYOUT_MT "Layout"
+#define BUILDER_MT "Builder"
+
+/* Default size of the window of streaming buffers */
+#ifndef BUFFER_WINDOW
+#define BUFFER_WINDOW (1024 * 1024)
+#endif
+
+/* Reference-counted contents that can be used by buffers in different states and threads */
+typedef struct Shared {
+    long refs;
+    void const* data;
+    size_t size;
+    void* owned;  /* Memory to free when the last reference is gone */
+    int mapped;
+    uint64_t handle;      /* Handle returned by buffer.share, 0 if none, guarded by handles_lock */
+    struct Shared* next;  /* Next shared contents with a handle */
+    uint8_t bytes[];
+}
+Shared;
 
 typedef struct {
     void const* data;
     size_t size;
     size_t position;
     int parent_ref;
+    int mapped;
+    unsigned bit;  /* Bits already read from the byte at position by buffer.bits */
+    Shared* shared;
+
+    /* Streaming buffers only, data is a window over the stream */
+    struct Source const* source;
+    void* handle;     /* The luaL_Stream or luaio_Stream, reader functions are the parent */
+    size_t base;      /* Stream offset of data[0] */
+    size_t capacity;  /* Allocated size of the window */
 }
 Buffer;
 
+/* Where streaming buffers read from, with the semantics of fread, fseek, and ftell */
+typedef struct Source {
+    size_t (*read)(lua_State* L, Buffer const* self, void* dst, size_t size);
+    int (*seek)(Buffer const* self, long offset, int whence);
+    long (*tell)(Buffer const* self);
+}
+Source;
+
 #define MODE_L   UINT32_C(0x0059701b)
 #define MODE_SB  UINT32_C(0x0059797a)
 #define MODE_UB  UINT32_C(0x005979bc)
@@ -44,6 +113,33 @@ Buffer;
 #define MODE_UQ  UINT32_C(0x005979cb)
 #define MODE_F   UINT32_C(0x0002b60b)
 #define MODE_D   UINT32_C(0x0002b609)
+#define MODE_ULEB UINT32_C(0x7c9f10ad)
+#define MODE_SLEB UINT32_C(0x7c9df7eb)
+#define MODE_ZLEB UINT32_C(0x7ca1ce92)
+
+/* Not a hash, used in layouts for strings with a fixed length */
+#define MODE_LENGTH UINT32_C(0)
+
+typedef struct {
+    uint32_t mode;
+    size_t length;
+}
+Field;
+
+typedef struct {
+    size_t count;
+    size_t size;  /* Total size of the fields, if none of them has a variable size */
+    int variable;
+    Field fields[];
+}
+Layout;
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+}
+Builder;
 
 static int is_le(void) {
     union {
@@ -56,413 +152,2885 @@ static int is_le(void) {
     return test.u8[0] != 0;
 }
 
-static int push(lua_State* L, void const* data, size_t size, int parent_index);
+#ifdef BUFFER_X86_64
+/*
+SSSE3 support, -1 until checked on first use. States opening the module in
+other threads may race on it, they all store the same value, and the atomic
+accesses keep that well defined.
+*/
+static int ssse3 = -1;
+
+static int has_ssse3(void) {
+    int has = __atomic_load_n(&ssse3, __ATOMIC_RELAXED);
+
+    if (has < 0) {
+        unsigned eax, ebx, ecx, edx;
+        has = __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSSE3) != 0;
+        __atomic_store_n(&ssse3, has, __ATOMIC_RELAXED);
+    }
 
-static Buffer* check(lua_State* const L, int const index) {
-    return (Buffer*)luaL_checkudata(L, index, BUFFER_MT);
+    return has;
 }
 
-static int l_read(lua_State* const L) {
-    Buffer* const self = check(L, 1);
+__attribute__((target("ssse3")))
+static size_t swap_ssse3(uint8_t* const dst, uint8_t const* const src, size_t const size, int const width) {
+    static uint8_t const masks[3][16] = {
+        {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+        {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+        {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8}
+    };
 
-    size_t position = self->position;
-    size_t const size = self->size;
-    uint8_t const* const data = ((uint8_t const*)self->data) + position;
+    __m128i const mask = _mm_loadu_si128((__m128i const*)masks[width == 2 ? 0 : width == 4 ? 1 : 2]);
+    size_t i = 0;
 
-    if (lua_type(L, 2) == LUA_TNUMBER) {
-        lua_Integer const length = lua_tointeger(L, 2);
+    for (; i + 16 <= size; i += 16) {
+        __m128i const x = _mm_loadu_si128((__m128i const*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(x, mask));
+    }
 
-        if (position + length > size) {
-invalid_position:
-                lua_pushnil(L);
-                lua_pushfstring(L, "invalid position: %I", (lua_Integer)position);
-                return 2;
-        }
+    return i;
+}
+#endif
 
-        self->position += length;
-        lua_pushlstring(L, (char const*)data, length);
-        return 1;
+/* Copies count elements of width bytes from src to dst, reversing the bytes of each one */
+static void swap_bytes(uint8_t* const dst, uint8_t const* const src, size_t const count, int const width) {
+    size_t const size = count * width;
+    size_t i = 0;
+
+#ifdef BUFFER_X86_64
+    if (has_ssse3()) {
+        i = swap_ssse3(dst, src, size, width);
     }
+#endif
 
-    size_t mode_len = 0;
-    char const* const mode = luaL_checklstring(L, 2, &mode_len);
-    uint32_t mode_hash = 5381;
+    for (; i < size; i += width) {
+        for (int j = 0; j < width; j++) {
+            dst[i + j] = src[i + width - 1 - j];
+        }
+    }
+}
 
-    for (size_t i = 0; i < mode_len; i++) {
-        mode_hash = mode_hash * 33 + (uint8_t)mode[i];
+/* Returns the offset of the first occurrence of needle in haystack, or size if not found */
+static size_t find_scalar(uint8_t const* const haystack, size_t const size, uint8_t const* const needle, size_t const length) {
+    if (length == 0) {
+        return 0;
     }
 
-    int const le = is_le();
+    if (length > size) {
+        return size;
+    }
 
-    switch (mode_hash) {
-        case MODE_SW:
-            mode_hash = le ? mode_hash = MODE_SWL : MODE_SWB;
-            break;
+    size_t const last = size - length;
+    size_t i = 0;
 
-        case MODE_UW:
-            mode_hash = le ? mode_hash = MODE_UWL : MODE_UWB;
-            break;
+    while (i <= last) {
+        uint8_t const* const found = (uint8_t const*)memchr(haystack + i, needle[0], last - i + 1);
 
-        case MODE_SD:
-            mode_hash = le ? mode_hash = MODE_SDL : MODE_SDB;
+        if (found == NULL) {
             break;
+        }
 
-        case MODE_UD:
-            mode_hash = le ? mode_hash = MODE_UDL : MODE_UDB;
-            break;
+        i = (size_t)(found - haystack);
 
-        case MODE_SQ:
-            mode_hash = le ? mode_hash = MODE_SQL : MODE_SQB;
-            break;
+        if (memcmp(found + 1, needle + 1, length - 1) == 0) {
+            return i;
+        }
 
-        case MODE_UQ:
-            mode_hash = le ? mode_hash = MODE_UQL : MODE_UQB;
-            break;
+        i++;
+    }
 
-        case MODE_F:
-            mode_hash = le ? mode_hash = MODE_FL : MODE_FB;
-            break;
+    return size;
+}
 
-        case MODE_D:
-            mode_hash = le ? mode_hash = MODE_DL : MODE_DB;
-            break;
-    }
+static size_t find(uint8_t const* const haystack, size_t const size, uint8_t const* const needle, size_t const length) {
+    size_t i = 0;
 
-    uint64_t value = 0;
+#ifdef BUFFER_X86_64
+    if (length >= 2 && length <= size) {
+        // Compare the first and last bytes of the needle at 16 positions at once, and
+        // only check the positions where both match.
+        __m128i const first = _mm_set1_epi8((char)needle[0]);
+        __m128i const last = _mm_set1_epi8((char)needle[length - 1]);
 
-    switch (mode_hash) {
-        case MODE_SB:
-        case MODE_UB:
-            if (position + 1 > size) {
-                goto invalid_position;
-            }
+        for (; i + length - 1 + 16 <= size; i += 16) {
+            __m128i const a = _mm_loadu_si128((__m128i const*)(haystack + i));
+            __m128i const b = _mm_loadu_si128((__m128i const*)(haystack + i + length - 1));
+            unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
 
-            value = (uint64_t)data[0];
-            position++;
-            break;
+            while (mask != 0) {
+                size_t const offset = i + (size_t)__builtin_ctz(mask);
 
-        case MODE_SWL:
-        case MODE_UWL:
-            if (position + 2 > size) {
-                goto invalid_position;
+                if (memcmp(haystack + offset + 1, needle + 1, length - 2) == 0) {
+                    return offset;
+                }
+
+                mask &= mask - 1;
             }
+        }
+    }
+#endif
 
-            value = (uint64_t)data[0];
-            value |= (uint64_t)data[1] << 8;
-            position += 2;
-            break;
+    return i + find_scalar(haystack + i, size - i, needle, length);
+}
 
-        case MODE_SWB:
-        case MODE_UWB:
-            if (position + 2 > size) {
-                goto invalid_position;
-            }
+/* Returns how many times byte occurs in data */
+static size_t count(uint8_t const* const data, size_t const size, uint8_t const byte) {
+    size_t total = 0;
+    size_t i = 0;
 
-            value = (uint64_t)data[0] << 8;
-            value |= (uint64_t)data[1];
-            position += 2;
-            break;
+#ifdef BUFFER_X86_64
+    __m128i const pattern = _mm_set1_epi8((char)byte);
 
-        case MODE_SDL:
-        case MODE_UDL:
-        case MODE_FL:
-            if (position + 4 > size) {
-                goto invalid_position;
-            }
+    while (size - i >= 16) {
+        // Each lane of the accumulator counts up to 255 matches before overflowing.
+        size_t const blocks = (size - i) / 16 < 255 ? (size - i) / 16 : 255;
+        __m128i acc = _mm_setzero_si128();
 
-            value = (uint64_t)data[0];
-            value |= (uint64_t)data[1] << 8;
-            value |= (uint64_t)data[2] << 16;
-            value |= (uint64_t)data[3] << 24;
-            position += 4;
-            break;
+        for (size_t j = 0; j < blocks; j++, i += 16) {
+            __m128i const x = _mm_loadu_si128((__m128i const*)(data + i));
+            acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(x, pattern));
+        }
 
-        case MODE_SDB:
-        case MODE_UDB:
-        case MODE_FB:
-            if (position + 4 > size) {
-                goto invalid_position;
-            }
+        __m128i const sums = _mm_sad_epu8(acc, _mm_setzero_si128());
+        total += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_cvtsi128_si32(_mm_unpackhi_epi64(sums, sums));
+    }
+#endif
 
-            value = (uint64_t)data[0] << 24;
-            value |= (uint64_t)data[1] << 16;
-            value |= (uint64_t)data[2] << 8;
-            value |= (uint64_t)data[3];
-            position += 4;
-            break;
+    for (; i < size; i++) {
+        total += data[i] == byte;
+    }
 
-        case MODE_SQL:
-        case MODE_UQL:
-        case MODE_DL:
-            if (position + 8 > size) {
-                goto invalid_position;
-            }
+    return total;
+}
 
-            value = (uint64_t)data[0];
-            value |= (uint64_t)data[1] << 8;
-            value |= (uint64_t)data[2] << 16;
-            value |= (uint64_t)data[3] << 24;
-            value |= (uint64_t)data[4] << 32;
-            value |= (uint64_t)data[5] << 40;
-            value |= (uint64_t)data[6] << 48;
-            value |= (uint64_t)data[7] << 56;
-            position += 8;
-            break;
+/* Decodes the UTF-8 character at data, and returns its length or 0 if it's invalid */
+static size_t utf8_decode(uint8_t const* const data, size_t const size, uint32_t* const codepoint) {
+    uint8_t const lead = data[0];
 
-        case MODE_SQB:
-        case MODE_UQB:
-        case MODE_DB:
-            if (position + 8 > size) {
-                goto invalid_position;
-            }
+    if (lead < 0x80) {
+        *codepoint = lead;
+        return 1;
+    }
 
-            value = (uint64_t)data[0] << 56;
-            value |= (uint64_t)data[1] << 48;
-            value |= (uint64_t)data[2] << 40;
-            value |= (uint64_t)data[3] << 32;
-            value |= (uint64_t)data[4] << 24;
-            value |= (uint64_t)data[5] << 16;
-            value |= (uint64_t)data[6] << 8;
-            value |= (uint64_t)data[7];
-            position += 8;
-            break;
+    size_t length = 0;
+    uint32_t value = 0, min = 0;
 
-        case MODE_L: {
-            if (position == size) {
-                lua_pushnil(L);
-                return 1;
-            }
+    if (lead >= 0xc2 && lead <= 0xdf) {
+        length = 2;
+        value = lead & 0x1f;
+        min = 0x80;
+    }
+    else if ((lead & 0xf0) == 0xe0) {
+        length = 3;
+        value = lead & 0x0f;
+        min = 0x800;
+    }
+    else if (lead >= 0xf0 && lead <= 0xf4) {
+        length = 4;
+        value = lead & 0x07;
+        min = 0x10000;
+    }
+    else {
+        return 0;
+    }
 
-            luaL_Buffer buffer;
-            luaL_buffinit(L, &buffer);
+    if (length > size) {
+        return 0;
+    }
 
-            uint8_t const* const data = (uint8_t const*)self->data;
+    for (size_t i = 1; i < length; i++) {
+        if ((data[i] & 0xc0) != 0x80) {
+            return 0;
+        }
 
-            while (position < size) {
-                uint8_t k = data[position++];
+        value = value << 6 | (data[i] & 0x3f);
+    }
 
-                if (k == '\r') {
-                    if (position == size || data[position++] != '\n') {
-                        // Stray \r in buffer.
-                        lua_pushnil(L);
-                        lua_pushfstring(L, "invalid end-of-line: \\r");
-                        return 2;
-                    }
+    // Reject overlong encodings, surrogates, and values beyond Unicode.
+    if (value < min || value > 0x10ffff || (value >= 0xd800 && value <= 0xdfff)) {
+        return 0;
+    }
 
-                    // Push line terminated by \r\n.
-                    break;
-                }
-                else if (k == '\n') {
-                    // Push line terminated by \n.
-                    break;
-                }
-                else {
-                    luaL_addchar(&buffer, k);
-                }
+    *codepoint = value;
+    return length;
+}
+
+/* Returns the offset of the first invalid UTF-8 sequence in data, or size if there's none */
+static size_t utf8_scalar(uint8_t const* const data, size_t const size) {
+    size_t i = 0;
+
+    while (i < size) {
+        if (size - i >= 8) {
+            uint64_t word;
+            memcpy(&word, data + i, sizeof(word));
+
+            if ((word & UINT64_C(0x8080808080808080)) == 0) {
+                i += 8;
+                continue;
             }
+        }
 
-            // Push last line without an end-of-line.
-            self->position = position;
-            luaL_pushresult(&buffer);
-            return 1;
+        uint32_t codepoint;
+        size_t const length = utf8_decode(data + i, size - i, &codepoint);
+
+        if (length == 0) {
+            return i;
         }
 
-        default:
-            lua_pushnil(L);
-            lua_pushfstring(L, "invalid mode: \"%s\"", mode);
-            return 2;
+        i += length;
     }
 
-    self->position = position;
+    return size;
+}
 
-    switch (mode_hash) {
-        case MODE_FL:
-        case MODE_FB: {
-            union {
-                float f;
-                uint32_t u32;
-            }
-            conv;
+#ifdef BUFFER_X86_64
+/*
+Validates 16 bytes at a time using three table lookups on the high and low
+nibbles of each byte and the previous one, which flag all the invalid two-byte
+combinations, plus a check for the continuation bytes expected after three-
+and four-byte sequences. See "Validating UTF-8 In Less Than One Instruction
+Per Byte", by John Keiser and Daniel Lemire. Returns size if the data is valid,
+or an offset before the first error where the scalar code can resume.
+*/
+__attribute__((target("ssse3")))
+static size_t utf8_ssse3(uint8_t const* const data, size_t const size) {
+    enum {
+        TOO_SHORT = 1 << 0, TOO_LONG = 1 << 1, OVERLONG_3 = 1 << 2, TOO_LARGE = 1 << 3,
+        SURROGATE = 1 << 4, OVERLONG_2 = 1 << 5, TOO_LARGE_1000 = 1 << 6, OVERLONG_4 = 1 << 6,
+        TWO_CONTS = 1 << 7, CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS
+    };
 
-            conv.u32 = (uint32_t)value;
-            lua_pushnumber(L, conv.f);
-            break;
+    static uint8_t const byte_1_high[16] = {
+        TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+        TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+        TOO_SHORT | OVERLONG_2,
+        TOO_SHORT,
+        TOO_SHORT | OVERLONG_3 | SURROGATE,
+        TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+    };
+
+    static uint8_t const byte_1_low[16] = {
+        CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+        CARRY | OVERLONG_2,
+        CARRY,
+        CARRY,
+        CARRY | TOO_LARGE,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000
+    };
+
+    static uint8_t const byte_2_high[16] = {
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+    };
+
+    __m128i const table_1_high = _mm_loadu_si128((__m128i const*)byte_1_high);
+    __m128i const table_1_low = _mm_loadu_si128((__m128i const*)byte_1_low);
+    __m128i const table_2_high = _mm_loadu_si128((__m128i const*)byte_2_high);
+    __m128i const nibble = _mm_set1_epi8(0x0f);
+    __m128i const zero = _mm_setzero_si128();
+
+    // Bytes at the end of a block that start a sequence which doesn't fit in it.
+    __m128i const max = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                      (char)0xef, (char)0xdf, (char)0xbf);
+
+    __m128i previous = zero;
+    __m128i incomplete = zero;
+
+    for (size_t i = 0;; i += 16) {
+        int const last = size - i < 16;
+        __m128i input;
+
+        if (!last) {
+            input = _mm_loadu_si128((__m128i const*)(data + i));
+        }
+        else {
+            // Pad the last block with zeros, which also flags sequences truncated at the end.
+            uint8_t tail[16] = {0};
+            memcpy(tail, data + i, size - i);
+            input = _mm_loadu_si128((__m128i const*)tail);
         }
 
-        case MODE_DL:
-        case MODE_DB: {
-            union {
-                double d;
-                uint64_t u64;
+        __m128i error = incomplete;
+
+        if (_mm_movemask_epi8(input) != 0) {
+            __m128i const prev1 = _mm_alignr_epi8(input, previous, 15);
+            __m128i const prev2 = _mm_alignr_epi8(input, previous, 14);
+            __m128i const prev3 = _mm_alignr_epi8(input, previous, 13);
+
+            __m128i const high1 = _mm_shuffle_epi8(table_1_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+            __m128i const low1 = _mm_shuffle_epi8(table_1_low, _mm_and_si128(prev1, nibble));
+            __m128i const high2 = _mm_shuffle_epi8(table_2_high, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+            __m128i const special = _mm_and_si128(_mm_and_si128(high1, low1), high2);
+
+            // Only bytes after the lead byte of three- and four-byte sequences end up with the high bit set.
+            __m128i const third = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xe0 - 0x80)));
+            __m128i const fourth = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xf0 - 0x80)));
+            __m128i const must23 = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char)0x80));
+
+            error = _mm_xor_si128(must23, special);
+        }
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xffff) {
+            // The error can involve up to three bytes of the previous block, go back to the
+            // start of the sequence.
+            size_t start = i < 3 ? 0 : i - 3;
+
+            while (start < i && (data[start] & 0xc0) == 0x80) {
+                start++;
             }
-            conv;
 
-            conv.u64 = value;
-            lua_pushnumber(L, conv.d);
-            break;
+            return start;
         }
 
-        case MODE_SB:
-        case MODE_SWL:
-        case MODE_SWB:
-        case MODE_SDL:
-        case MODE_SDB:
-        case MODE_SQL:
-        case MODE_SQB:
-            lua_pushinteger(L, (int64_t)value);
-            break;
+        if (last) {
+            return size;
+        }
 
-        default:
-            lua_pushinteger(L, value);
-            break;
+        incomplete = _mm_subs_epu8(input, max);
+        previous = input;
     }
-
-    return 1;
 }
+#endif
 
-static int l_seek(lua_State* const L) {
-    Buffer* const self = check(L, 1);
-    lua_Integer const offset = luaL_checkinteger(L, 2);
-    char const* const whence = luaL_optstring(L, 3, "set");
+/* Returns the offset of the first invalid UTF-8 sequence in data, or size if there's none */
+static size_t utf8_check(uint8_t const* const data, size_t const size) {
+    size_t i = 0;
 
-    lua_Integer position = 0;
+#ifdef BUFFER_X86_64
+    if (has_ssse3()) {
+        i = utf8_ssse3(data, size);
 
-    if (strcmp(whence, "set") == 0) {
-        position = offset;
-    }
-    else if (strcmp(whence, "cur") == 0) {
-        position = self->position + offset;
-    }
-    else if (strcmp(whence, "end") == 0) {
-        position = self->size - offset;
+        if (i == size) {
+            return size;
+        }
     }
-    else {
-        lua_pushnil(L);
-        lua_pushfstring(L, "invalid seek mode: \"%s\"", whence);
-        return 2;
+#endif
+
+    return i + utf8_scalar(data + i, size - i);
+}
+
+/* Returns how many characters are in valid UTF-8 data, by counting the bytes that aren't continuations */
+static size_t utf8_count(uint8_t const* const data, size_t const size) {
+    size_t total = 0;
+    size_t i = 0;
+
+#ifdef BUFFER_X86_64
+    // Continuation bytes are 0x80 to 0xbf, i.e. less than -64 as signed bytes.
+    __m128i const continuation = _mm_set1_epi8(-65);
+
+    while (size - i >= 16) {
+        size_t const blocks = (size - i) / 16 < 255 ? (size - i) / 16 : 255;
+        __m128i acc = _mm_setzero_si128();
+
+        for (size_t j = 0; j < blocks; j++, i += 16) {
+            __m128i const x = _mm_loadu_si128((__m128i const*)(data + i));
+            acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(x, continuation));
+        }
+
+        __m128i const sums = _mm_sad_epu8(acc, _mm_setzero_si128());
+        total += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_cvtsi128_si32(_mm_unpackhi_epi64(sums, sums));
     }
+#endif
 
-    if (position < 0 || position > self->size) {
-        lua_pushnil(L);
-        lua_pushfstring(L, "invalid seek position: %I", position);
-        return 2;
+    for (; i < size; i++) {
+        total += (data[i] & 0xc0) != 0x80;
     }
 
-    self->position = (size_t)position;
-    lua_pushinteger(L, position);
-    return 1;
+    return total;
 }
 
-static int l_tell(lua_State* const L) {
+static char const hex_digits[] = "0123456789abcdef";
+
+static char const base64_digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#ifdef BUFFER_X86_64
+/* Encodes 16 bytes into 32 hexadecimal digits at a time, returns how many bytes were encoded */
+__attribute__((target("ssse3")))
+static size_t hex_ssse3(char* const dst, uint8_t const* const src, size_t const size) {
+    __m128i const digits = _mm_loadu_si128((__m128i const*)hex_digits);
+    __m128i const nibble = _mm_set1_epi8(0x0f);
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m128i const x = _mm_loadu_si128((__m128i const*)(src + i));
+        __m128i const high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(x, 4), nibble));
+        __m128i const low = _mm_shuffle_epi8(digits, _mm_and_si128(x, nibble));
+
+        _mm_storeu_si128((__m128i*)(dst + i * 2), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128((__m128i*)(dst + i * 2 + 16), _mm_unpackhi_epi8(high, low));
+    }
+
+    return i;
+}
+
+/*
+Encodes 12 bytes into 16 base64 digits at a time, returns how many bytes were
+encoded. See "Base64 encoding with SIMD instructions", by Wojciech Muła.
+*/
+__attribute__((target("ssse3")))
+static size_t base64_encode_ssse3(char* const dst, uint8_t const* const src, size_t const size) {
+    // Offsets from the 6-bit values to the digits, selected by the ranges A-Z, a-z, 0-9, +, and /.
+    __m128i const offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    size_t i = 0, j = 0;
+
+    // 16 bytes are loaded but only 12 are used.
+    for (; i + 16 <= size; i += 12, j += 16) {
+        __m128i x = _mm_loadu_si128((__m128i const*)(src + i));
+
+        // Spread each group of 3 bytes into 4 bytes, and move the 6-bit values to their own bytes.
+        x = _mm_shuffle_epi8(x, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+        __m128i const a = _mm_mulhi_epu16(_mm_and_si128(x, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+        __m128i const b = _mm_mullo_epi16(_mm_and_si128(x, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+        __m128i const values = _mm_or_si128(a, b);
+
+        __m128i range = _mm_subs_epu8(values, _mm_set1_epi8(51));
+        range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), values), _mm_set1_epi8(13)));
+
+        _mm_storeu_si128((__m128i*)(dst + j), _mm_add_epi8(values, _mm_shuffle_epi8(offsets, range)));
+    }
+
+    return i;
+}
+
+/*
+Decodes 16 base64 digits into 12 bytes at a time, and returns how many digits
+were decoded. Stops at the first block with an invalid digit, which is left for
+the scalar code to report. dst must have 4 extra bytes, since 16 are stored
+each time. See "Base64 decoding with SIMD instructions", by Wojciech Muła.
+*/
+__attribute__((target("ssse3")))
+static size_t base64_decode_ssse3(uint8_t* const dst, char const* const src, size_t const length) {
+    // Invalid digits have a bit in common in both lookups by their low and high nibbles.
+    __m128i const invalid_low = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                              0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    __m128i const invalid_high = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+
+    // Offsets from the digits to their 6-bit values, selected by the high nibble, with / apart.
+    __m128i const offsets = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    __m128i const nibble = _mm_set1_epi8(0x0f);
+    __m128i const slash = _mm_set1_epi8('/');
+    size_t i = 0, j = 0;
+
+    for (; i + 16 <= length; i += 16, j += 12) {
+        __m128i x = _mm_loadu_si128((__m128i const*)(src + i));
+
+        __m128i const high = _mm_and_si128(_mm_srli_epi32(x, 4), nibble);
+        __m128i const low = _mm_and_si128(x, nibble);
+        __m128i const invalid = _mm_and_si128(_mm_shuffle_epi8(invalid_low, low), _mm_shuffle_epi8(invalid_high, high));
+
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(invalid, _mm_setzero_si128())) != 0) {
+            break;
+        }
+
+        x = _mm_add_epi8(x, _mm_shuffle_epi8(offsets, _mm_add_epi8(_mm_cmpeq_epi8(x, slash), high)));
+
+        // Join the 6-bit values into 24-bit groups, and pack their bytes in big-endian order.
+        x = _mm_maddubs_epi16(x, _mm_set1_epi32(0x01400140));
+        x = _mm_madd_epi16(x, _mm_set1_epi32(0x00011000));
+        x = _mm_shuffle_epi8(x, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        _mm_storeu_si128((__m128i*)(dst + j), x);
+    }
+
+    return i;
+}
+#endif
+
+static void hex_encode(char* const dst, uint8_t const* const src, size_t const size) {
+    size_t i = 0;
+
+#ifdef BUFFER_X86_64
+    if (has_ssse3()) {
+        i = hex_ssse3(dst, src, size);
+    }
+#endif
+
+    for (; i < size; i++) {
+        dst[i * 2] = hex_digits[src[i] >> 4];
+        dst[i * 2 + 1] = hex_digits[src[i] & 15];
+    }
+}
+
+/* Encodes size bytes into 4 * ceil(size / 3) base64 digits, with padding */
+static void base64_encode(char* dst, uint8_t const* const src, size_t const size) {
+    size_t i = 0;
+
+#ifdef BUFFER_X86_64
+    if (has_ssse3()) {
+        i = base64_encode_ssse3(dst, src, size);
+        dst += i / 3 * 4;
+    }
+#endif
+
+    for (; i + 3 <= size; i += 3) {
+        uint32_t const group = (uint32_t)src[i] << 16 | (uint32_t)src[i + 1] << 8 | src[i + 2];
+        *dst++ = base64_digits[group >> 18];
+        *dst++ = base64_digits[group >> 12 & 63];
+        *dst++ = base64_digits[group >> 6 & 63];
+        *dst++ = base64_digits[group & 63];
+    }
+
+    if (i < size) {
+        uint32_t const group = (uint32_t)src[i] << 16 | (i + 1 < size ? (uint32_t)src[i + 1] << 8 : 0);
+        *dst++ = base64_digits[group >> 18];
+        *dst++ = base64_digits[group >> 12 & 63];
+        *dst++ = i + 1 < size ? base64_digits[group >> 6 & 63] : '=';
+        *dst++ = '=';
+    }
+}
+
+/* Returns the 6-bit value of a base64 digit, or -1 if it's invalid */
+static int base64_value(char const digit) {
+    if (digit >= 'A' && digit <= 'Z') {
+        return digit - 'A';
+    }
+    else if (digit >= 'a' && digit <= 'z') {
+        return digit - 'a' + 26;
+    }
+    else if (digit >= '0' && digit <= '9') {
+        return digit - '0' + 52;
+    }
+    else if (digit == '+') {
+        return 62;
+    }
+    else if (digit == '/') {
+        return 63;
+    }
+
+    return -1;
+}
+
+/*
+Decodes length base64 digits without padding into dst, which must have room for
+length * 3 / 4 + 4 bytes. Returns the number of bytes decoded, or sets error to
+the position of the first invalid digit.
+*/
+static size_t base64_decode(uint8_t* const dst, char const* const src, size_t const length, size_t* const error) {
+    size_t i = 0, j = 0;
+
+#ifdef BUFFER_X86_64
+    if (has_ssse3()) {
+        i = base64_decode_ssse3(dst, src, length);
+        j = i / 4 * 3;
+    }
+#endif
+
+    uint32_t group = 0;
+    unsigned digits = 0;
+
+    for (; i < length; i++) {
+        int const value = base64_value(src[i]);
+
+        if (value < 0) {
+            *error = i;
+            return 0;
+        }
+
+        group = group << 6 | (uint32_t)value;
+
+        if (++digits == 4) {
+            dst[j++] = (uint8_t)(group >> 16);
+            dst[j++] = (uint8_t)(group >> 8);
+            dst[j++] = (uint8_t)group;
+            group = 0;
+            digits = 0;
+        }
+    }
+
+    // A trailing group of 2 or 3 digits has 1 or 2 bytes.
+    if (digits == 1) {
+        *error = length - 1;
+        return 0;
+    }
+    else if (digits == 2) {
+        dst[j++] = (uint8_t)(group >> 4);
+    }
+    else if (digits == 3) {
+        dst[j++] = (uint8_t)(group >> 10);
+        dst[j++] = (uint8_t)(group >> 2);
+    }
+
+    *error = SIZE_MAX;
+    return j;
+}
+
+static int push(lua_State* L, void const* data, size_t size, int parent_index);
+
+static Buffer* check(lua_State* const L, int const index) {
+    return (Buffer*)luaL_checkudata(L, index, BUFFER_MT);
+}
+
+/* Hashes a mode, resolving the modes in the machine's endian mode to the explicit ones */
+static uint32_t hash_mode(char const* const mode, size_t const mode_len) {
+    uint32_t mode_hash = 5381;
+
+    for (size_t i = 0; i < mode_len; i++) {
+        mode_hash = mode_hash * 33 + (uint8_t)mode[i];
+    }
+
+    int const le = is_le();
+
+    switch (mode_hash) {
+        case MODE_SW: return le ? MODE_SWL : MODE_SWB;
+        case MODE_UW: return le ? MODE_UWL : MODE_UWB;
+        case MODE_SD: return le ? MODE_SDL : MODE_SDB;
+        case MODE_UD: return le ? MODE_UDL : MODE_UDB;
+        case MODE_SQ: return le ? MODE_SQL : MODE_SQB;
+        case MODE_UQ: return le ? MODE_UQL : MODE_UQB;
+        case MODE_F:  return le ? MODE_FL : MODE_FB;
+        case MODE_D:  return le ? MODE_DL : MODE_DB;
+    }
+
+    return mode_hash;
+}
+
+/* Returns the number of bytes read by a resolved mode, 0 for variable sizes, or -1 for invalid modes */
+static int mode_size(uint32_t const mode_hash) {
+    switch (mode_hash) {
+        case MODE_SB:
+        case MODE_UB:
+            return 1;
+
+        case MODE_SWL:
+        case MODE_SWB:
+        case MODE_UWL:
+        case MODE_UWB:
+            return 2;
+
+        case MODE_SDL:
+        case MODE_SDB:
+        case MODE_UDL:
+        case MODE_UDB:
+        case MODE_FL:
+        case MODE_FB:
+            return 4;
+
+        case MODE_SQL:
+        case MODE_SQB:
+        case MODE_UQL:
+        case MODE_UQB:
+        case MODE_DL:
+        case MODE_DB:
+            return 8;
+
+        case MODE_L:
+        case MODE_ULEB:
+        case MODE_SLEB:
+        case MODE_ZLEB:
+            return 0;
+
+        default:
+            return -1;
+    }
+}
+
+/* Returns true if a resolved mode is big-endian */
+static int mode_is_be(uint32_t const mode_hash) {
+    switch (mode_hash) {
+        case MODE_SWB:
+        case MODE_UWB:
+        case MODE_SDB:
+        case MODE_UDB:
+        case MODE_SQB:
+        case MODE_UQB:
+        case MODE_FB:
+        case MODE_DB:
+            return 1;
+
+        default:
+            return 0;
+    }
+}
+
+/* Lua files, closed files read as empty since their FILE is gone */
+static size_t file_read(lua_State* const L, Buffer const* const self, void* const dst, size_t const size) {
+    luaL_Stream* const file = (luaL_Stream*)self->handle;
+    (void)L;
+    return file->closef != NULL ? fread(dst, 1, size, file->f) : 0;
+}
+
+static int file_seek(Buffer const* const self, long const offset, int const whence) {
+    luaL_Stream* const file = (luaL_Stream*)self->handle;
+    return file->closef != NULL ? fseek(file->f, offset, whence) : -1;
+}
+
+static long file_tell(Buffer const* const self) {
+    luaL_Stream* const file = (luaL_Stream*)self->handle;
+    return file->closef != NULL ? ftell(file->f) : -1;
+}
+
+static Source const file_source = {file_read, file_seek, file_tell};
+
+/* Reader functions are called with the number of bytes wanted, and return them like io.read */
+static size_t reader_read(lua_State* const L, Buffer const* const self, void* const dst, size_t const size) {
+    lua_rawgeti(L, LUA_REGISTRYINDEX, self->parent_ref);
+    lua_pushinteger(L, (lua_Integer)size);
+    lua_call(L, 1, 1);
+
+    if (lua_type(L, -1) != LUA_TSTRING) {
+        if (!lua_isnil(L, -1)) {
+            luaL_error(L, "reader must return a string or nil");
+        }
+
+        // nil is the end of the stream.
+        lua_pop(L, 1);
+        return 0;
+    }
+
+    size_t length = 0;
+    char const* const data = lua_tolstring(L, -1, &length);
+
+    if (length > size) {
+        luaL_error(L, "reader returned more than %I bytes", (lua_Integer)size);
+    }
+
+    memcpy(dst, data, length);
+    lua_pop(L, 1);
+    return length;
+}
+
+/* Reader functions can't seek, streaming buffers over them can only seek within the window */
+static int reader_seek(Buffer const* const self, long const offset, int const whence) {
+    (void)self;
+    (void)offset;
+    (void)whence;
+    return -1;
+}
+
+static long reader_tell(Buffer const* const self) {
+    (void)self;
+    return -1;
+}
+
+static Source const reader_source = {reader_read, reader_seek, reader_tell};
+
+#ifdef BUFFER_LUAIO
+static size_t stream_read(lua_State* const L, Buffer const* const self, void* const dst, size_t const size) {
+    luaio_Stream* const stream = (luaio_Stream*)self->handle;
+    (void)L;
+    return !stream->isclosed ? stream->vtable->fread(dst, 1, size, stream) : 0;
+}
+
+static int stream_seek(Buffer const* const self, long const offset, int const whence) {
+    luaio_Stream* const stream = (luaio_Stream*)self->handle;
+    return !stream->isclosed ? stream->vtable->fseek(stream, offset, whence) : -1;
+}
+
+static long stream_tell(Buffer const* const self) {
+    luaio_Stream* const stream = (luaio_Stream*)self->handle;
+    return !stream->isclosed ? stream->vtable->ftell(stream) : -1;
+}
+
+static Source const stream_source = {stream_read, stream_seek, stream_tell};
+#endif
+
+/*
+Moves the unread bytes to the start of the window and reads more from the
+stream. Returns false if the window couldn't grow to needed bytes.
+*/
+static int refill(lua_State* const L, Buffer* const self, size_t const needed) {
+    uint8_t* data = (uint8_t*)self->data;
+    size_t const available = self->size - self->position;
+
+    memmove(data, data + self->position, available);
+    self->base += self->position;
+    self->position = 0;
+    self->size = available;
+
+    if (needed > self->capacity) {
+        size_t capacity = self->capacity;
+
+        while (capacity < needed) {
+            capacity = capacity > SIZE_MAX / 2 ? needed : capacity * 2;
+        }
+
+        data = (uint8_t*)realloc(data, capacity);
+
+        if (data == NULL) {
+            return 0;
+        }
+
+        self->data = data;
+        self->capacity = capacity;
+    }
+
+    // Fill the entire window to read the stream in large blocks.
+    while (self->size < needed) {
+        size_t const count = self->source->read(L, self, data + self->size, self->capacity - self->size);
+
+        if (count == 0) {
+            break;
+        }
+
+        self->size += count;
+    }
+
+    return 1;
+}
+
+/* Returns the size of the stream, leaving it positioned at the end of the window */
+static lua_Integer stream_size(Buffer const* const self) {
+    Source const* const source = self->source;
+    long size = -1;
+
+    if (source->seek(self, 0, SEEK_END) == 0) {
+        size = source->tell(self);
+    }
+
+    if (source->seek(self, (long)(self->base + self->size), SEEK_SET) != 0) {
+        return -1;
+    }
+
+    return size;
+}
+
+/*
+Returns 1 if at least needed bytes are available, refilling streaming buffers,
+0 if they aren't, and -1 if the window of a streaming buffer couldn't grow.
+*/
+static int ensure(lua_State* const L, Buffer* const self, size_t const needed) {
+    size_t const available = self->size - self->position;
+
+    if (needed > available && self->source != NULL) {
+        if (!refill(L, self, needed)) {
+            return -1;
+        }
+
+        return needed <= self->size - self->position;
+    }
+
+    return needed <= available;
+}
+
+/* Sets the absolute read position, moving the window of streaming buffers if needed */
+static int set_position(Buffer* const self, size_t const position) {
+    self->bit = 0;
+
+    if (position >= self->base && position - self->base <= self->size) {
+        self->position = position - self->base;
+        return 1;
+    }
+
+    if (self->source != NULL) {
+        if (position > LONG_MAX || self->source->seek(self, (long)position, SEEK_SET) != 0) {
+            return 0;
+        }
+
+        // Empty the window, the next read will refill it.
+        self->base = position;
+        self->size = 0;
+        self->position = 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+static int invalid_position(lua_State* const L, Buffer const* const self, size_t const position) {
+    lua_pushnil(L);
+    lua_pushfstring(L, "invalid position: %I", (lua_Integer)(self->base + position));
+    return 2;
+}
+
+static int out_of_memory(lua_State* const L) {
+    lua_pushnil(L);
+    lua_pushliteral(L, "out of memory");
+    return 2;
+}
+
+static int unsupported_on_stream(lua_State* const L) {
+    lua_pushnil(L);
+    lua_pushliteral(L, "operation not supported on streaming buffers");
+    return 2;
+}
+
+/* Reads a string with length bytes */
+static int read_string(lua_State* const L, Buffer* const self, size_t const length) {
+    if (ensure(L, self, length) < 0) {
+        return out_of_memory(L);
+    }
+
+    size_t const position = self->position;
+
+    if (length > self->size - position) {
+        return invalid_position(L, self, position);
+    }
+
+    self->position += length;
+    self->bit = 0;
+    lua_pushlstring(L, (char const*)self->data + position, length);
+    return 1;
+}
+
+/*
+Decodes a LEB128 value with at most 10 bytes, and returns the number of bytes
+used or 0 if it's truncated or too long. bits is set to the number of value
+bits decoded, for sign extension.
+*/
+static size_t decode_varint(uint8_t const* const data, size_t const available, uint64_t* const value, unsigned* const bits) {
+    if (available >= 8) {
+        // Branch-reduced path, decodes values up to 8 bytes without looping over them.
+        uint64_t word = (uint64_t)data[0] | (uint64_t)data[1] << 8 | (uint64_t)data[2] << 16 |
+                        (uint64_t)data[3] << 24 | (uint64_t)data[4] << 32 | (uint64_t)data[5] << 40 |
+                        (uint64_t)data[6] << 48 | (uint64_t)data[7] << 56;
+
+        uint64_t const stops = ~word & UINT64_C(0x8080808080808080);
+
+        if (stops != 0) {
+            // All the bits up to the continuation bit of the last byte.
+            uint64_t const keep = stops ^ (stops - 1);
+            size_t const length = (size_t)((((keep >> 7) & UINT64_C(0x0101010101010101)) * UINT64_C(0x0101010101010101)) >> 56);
+
+            // Gather the 7-bit groups into 14, 28, and then 56 contiguous bits.
+            word &= keep & UINT64_C(0x7f7f7f7f7f7f7f7f);
+            word = ((word & UINT64_C(0x7f007f007f007f00)) >> 1) | (word & UINT64_C(0x007f007f007f007f));
+            word = ((word & UINT64_C(0x3fff00003fff0000)) >> 2) | (word & UINT64_C(0x00003fff00003fff));
+            word = ((word & UINT64_C(0x0fffffff00000000)) >> 4) | (word & UINT64_C(0x000000000fffffff));
+
+            *value = word;
+            *bits = (unsigned)length * 7;
+            return length;
+        }
+    }
+
+    uint64_t result = 0;
+    unsigned shift = 0;
+
+    for (size_t i = 0; i < available && i < 10; i++) {
+        uint8_t const byte = data[i];
+        result |= (uint64_t)(byte & 0x7f) << shift;
+        shift += 7;
+
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            *bits = shift;
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Converts a decoded LEB128 value according to its mode */
+static lua_Integer varint_value(uint32_t const mode_hash, uint64_t const value, unsigned const bits) {
+    switch (mode_hash) {
+        case MODE_SLEB:
+            if (bits < 64 && (value >> (bits - 1) & 1) != 0) {
+                return (lua_Integer)(value | ~UINT64_C(0) << bits);
+            }
+
+            return (lua_Integer)value;
+
+        case MODE_ZLEB:
+            return (lua_Integer)((value >> 1) ^ (~(value & 1) + 1));
+
+        default:
+            return (lua_Integer)value;
+    }
+}
+
+static int read_varint(lua_State* const L, Buffer* const self, uint32_t const mode_hash) {
+    if (ensure(L, self, 10) < 0) {
+        return out_of_memory(L);
+    }
+
+    size_t const position = self->position;
+    size_t const available = self->size - position;
+
+    uint64_t value = 0;
+    unsigned bits = 0;
+    size_t const length = decode_varint((uint8_t const*)self->data + position, available, &value, &bits);
+
+    if (length == 0) {
+        if (available >= 10) {
+            lua_pushnil(L);
+            lua_pushfstring(L, "invalid varint at position: %I", (lua_Integer)(self->base + position));
+            return 2;
+        }
+
+        return invalid_position(L, self, position);
+    }
+
+    self->position += length;
+    self->bit = 0;
+    lua_pushinteger(L, varint_value(mode_hash, value, bits));
+    return 1;
+}
+
+/* Reads a line terminated by \n or \r\n, or the last line without an end-of-line */
+static int read_line(lua_State* const L, Buffer* const self) {
+    int const any = ensure(L, self, 1);
+
+    if (any < 0) {
+        return out_of_memory(L);
+    }
+    else if (any == 0) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    char const* lf = NULL;
+    size_t scanned = 0;
+
+    for (;;) {
+        char const* const begin = (char const*)self->data + self->position;
+        size_t const available = self->size - self->position;
+        lf = (char const*)memchr(begin + scanned, '\n', available - scanned);
+
+        if (lf != NULL) {
+            break;
+        }
+
+        // Streaming buffers read more until the end-of-line is in the window.
+        int const more = ensure(L, self, available + 1);
+
+        if (more < 0) {
+            return out_of_memory(L);
+        }
+        else if (more == 0) {
+            break;
+        }
+
+        scanned = available;
+    }
+
+    size_t const position = self->position;
+    size_t const size = self->size;
+    char const* const begin = (char const*)self->data + position;
+    size_t const available = size - position;
+    size_t length = lf != NULL ? (size_t)(lf - begin) : available;
+    char const* const cr = (char const*)memchr(begin, '\r', length);
+
+    if (cr != NULL) {
+        if (lf == NULL || cr != lf - 1) {
+            // Stray \r in buffer.
+            lua_pushnil(L);
+            lua_pushfstring(L, "invalid end-of-line: \\r");
+            return 2;
+        }
+
+        // Line terminated by \r\n.
+        length--;
+    }
+
+    self->position = lf != NULL ? (size_t)(lf - (char const*)self->data) + 1 : size;
+    self->bit = 0;
+    lua_pushlstring(L, begin, length);
+    return 1;
+}
+
+/* Pushes a value of a resolved mode with a fixed size, loaded into value */
+static void push_value(lua_State* const L, uint32_t const mode_hash, uint64_t const value) {
+    switch (mode_hash) {
+        case MODE_FL:
+        case MODE_FB: {
+            union {
+                float f;
+                uint32_t u32;
+            }
+            conv;
+
+            conv.u32 = (uint32_t)value;
+            lua_pushnumber(L, conv.f);
+            break;
+        }
+
+        case MODE_DL:
+        case MODE_DB: {
+            union {
+                double d;
+                uint64_t u64;
+            }
+            conv;
+
+            conv.u64 = value;
+            lua_pushnumber(L, conv.d);
+            break;
+        }
+
+        case MODE_SQL:
+        case MODE_SQB:
+            lua_pushinteger(L, (int64_t)value);
+            break;
+
+        default:
+            lua_pushinteger(L, value);
+            break;
+    }
+}
+
+/*
+Reads a value of a resolved mode, and returns 1 after pushing it, 2 after
+pushing nil and an error message, or 0 without pushing anything if the mode
+is invalid.
+*/
+static int read_value(lua_State* const L, Buffer* const self, uint32_t const mode_hash) {
+    if (ensure(L, self, 8) < 0) {
+        return out_of_memory(L);
+    }
+
+    size_t position = self->position;
+    size_t const size = self->size;
+    uint8_t const* const data = ((uint8_t const*)self->data) + position;
+
+    uint64_t value = 0;
+
+    switch (mode_hash) {
+        case MODE_SB:
+        case MODE_UB:
+            if (position + 1 > size) {
+                return invalid_position(L, self, position);
+            }
+
+            value = (uint64_t)data[0];
+            position++;
+            break;
+
+        case MODE_SWL:
+        case MODE_UWL:
+            if (position + 2 > size) {
+                return invalid_position(L, self, position);
+            }
+
+            value = (uint64_t)data[0];
+            value |= (uint64_t)data[1] << 8;
+            position += 2;
+            break;
+
+        case MODE_SWB:
+        case MODE_UWB:
+            if (position + 2 > size) {
+                return invalid_position(L, self, position);
+            }
+
+            value = (uint64_t)data[0] << 8;
+            value |= (uint64_t)data[1];
+            position += 2;
+            break;
+
+        case MODE_SDL:
+        case MODE_UDL:
+        case MODE_FL:
+            if (position + 4 > size) {
+                return invalid_position(L, self, position);
+            }
+
+            value = (uint64_t)data[0];
+            value |= (uint64_t)data[1] << 8;
+            value |= (uint64_t)data[2] << 16;
+            value |= (uint64_t)data[3] << 24;
+            position += 4;
+            break;
+
+        case MODE_SDB:
+        case MODE_UDB:
+        case MODE_FB:
+            if (position + 4 > size) {
+                return invalid_position(L, self, position);
+            }
+
+            value = (uint64_t)data[0] << 24;
+            value |= (uint64_t)data[1] << 16;
+            value |= (uint64_t)data[2] << 8;
+            value |= (uint64_t)data[3];
+            position += 4;
+            break;
+
+        case MODE_SQL:
+        case MODE_UQL:
+        case MODE_DL:
+            if (position + 8 > size) {
+                return invalid_position(L, self, position);
+            }
+
+            value = (uint64_t)data[0];
+            value |= (uint64_t)data[1] << 8;
+            value |= (uint64_t)data[2] << 16;
+            value |= (uint64_t)data[3] << 24;
+            value |= (uint64_t)data[4] << 32;
+            value |= (uint64_t)data[5] << 40;
+            value |= (uint64_t)data[6] << 48;
+            value |= (uint64_t)data[7] << 56;
+            position += 8;
+            break;
+
+        case MODE_SQB:
+        case MODE_UQB:
+        case MODE_DB:
+            if (position + 8 > size) {
+                return invalid_position(L, self, position);
+            }
+
+            value = (uint64_t)data[0] << 56;
+            value |= (uint64_t)data[1] << 48;
+            value |= (uint64_t)data[2] << 40;
+            value |= (uint64_t)data[3] << 32;
+            value |= (uint64_t)data[4] << 24;
+            value |= (uint64_t)data[5] << 16;
+            value |= (uint64_t)data[6] << 8;
+            value |= (uint64_t)data[7];
+            position += 8;
+            break;
+
+        case MODE_L:
+            return read_line(L, self);
+
+        case MODE_ULEB:
+        case MODE_SLEB:
+        case MODE_ZLEB:
+            return read_varint(L, self, mode_hash);
+
+        default:
+            return 0;
+    }
+
+    self->position = position;
+    self->bit = 0;
+    push_value(L, mode_hash, value);
+    return 1;
+}
+
+static int l_read(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+
+    if (lua_type(L, 2) == LUA_TNUMBER) {
+        lua_Integer const length = lua_tointeger(L, 2);
+
+        if (length < 0) {
+            return invalid_position(L, self, self->position);
+        }
+
+        return read_string(L, self, (size_t)length);
+    }
+
+    size_t mode_len = 0;
+    char const* const mode = luaL_checklstring(L, 2, &mode_len);
+    int const pushed = read_value(L, self, hash_mode(mode, mode_len));
+
+    if (pushed == 0) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid mode: \"%s\"", mode);
+        return 2;
+    }
+
+    return pushed;
+}
+
+static int l_read_varints(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+    lua_Integer const count = luaL_checkinteger(L, 2);
+    size_t mode_len = 0;
+    char const* const mode = luaL_optlstring(L, 3, "uleb", &mode_len);
+
+    uint32_t const mode_hash = hash_mode(mode, mode_len);
+
+    if (mode_hash != MODE_ULEB && mode_hash != MODE_SLEB && mode_hash != MODE_ZLEB) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid mode: \"%s\"", mode);
+        return 2;
+    }
+
+    // Each value has at least one byte, only the window can be checked for streaming buffers.
+    size_t const available = self->size - self->position;
+
+    if (count < 0 || (self->source == NULL && (size_t)count > available)) {
+        return invalid_position(L, self, self->position);
+    }
+
+    lua_Integer const hint = (size_t)count < available ? count : (lua_Integer)available;
+    lua_createtable(L, hint < INT_MAX ? (int)hint : INT_MAX, 0);
+
+    size_t const start = self->base + self->position;
+    unsigned const bit = self->bit;
+
+    for (lua_Integer i = 1; i <= count; i++) {
+        if (ensure(L, self, 10) < 0) {
+            lua_pop(L, 1);
+            set_position(self, start);
+            self->bit = bit;
+            return out_of_memory(L);
+        }
+
+        size_t const position = self->position;
+        size_t const left = self->size - position;
+        uint64_t value = 0;
+        unsigned bits = 0;
+        size_t const length = decode_varint((uint8_t const*)self->data + position, left, &value, &bits);
+
+        if (length == 0) {
+            // Restore the position, the window of streaming buffers may have moved.
+            lua_Integer const at = (lua_Integer)(self->base + position);
+            lua_pop(L, 1);
+            set_position(self, start);
+            self->bit = bit;
+
+            lua_pushnil(L);
+            lua_pushfstring(L, left >= 10 ? "invalid varint at position: %I" : "invalid position: %I", at);
+            return 2;
+        }
+
+        self->position = position + length;
+        self->bit = 0;
+        lua_pushinteger(L, varint_value(mode_hash, value, bits));
+        lua_rawseti(L, -2, i);
+    }
+
+    return 1;
+}
+
+/* Gets an optional start position, defaulting to the current read position */
+static int check_init(lua_State* const L, Buffer const* const self, int const index, size_t* const init) {
+    lua_Integer const position = luaL_optinteger(L, index, (lua_Integer)self->position);
+
+    if (position < 0 || (size_t)position > self->size) {
+        invalid_position(L, self, (size_t)position);
+        return 0;
+    }
+
+    *init = (size_t)position;
+    return 1;
+}
+
+/*
+Finds needle in a streaming buffer, refilling the window as needed and keeping
+the last length - 1 bytes of each window in case a match spans a refill. Reader
+sources can't seek back, so the window grows to keep the read position.
+*/
+static int find_stream(lua_State* const L, Buffer* const self, uint8_t const* const needle, size_t const length) {
+    size_t const saved = self->base + self->position;
+    unsigned const bit = self->bit;
+    lua_Integer const init = luaL_optinteger(L, 3, (lua_Integer)saved);
+    int const seekable = self->source->tell(self) >= 0;
+    size_t scanned = 0;
+
+    if (!seekable && init > (lua_Integer)saved) {
+        scanned = (size_t)init - saved;
+    }
+    else if (init < 0 || !set_position(self, (size_t)init)) {
+        self->bit = bit;
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid position: %I", init);
+        return 2;
+    }
+
+    lua_Integer found = -1;
+
+    for (;;) {
+        size_t const available = self->size - self->position;
+        size_t next = scanned;
+
+        if (available >= scanned) {
+            size_t const left = available - scanned;
+            size_t const offset = find((uint8_t const*)self->data + self->position + scanned, left, needle, length);
+
+            if (offset != left || length == 0) {
+                found = (lua_Integer)(self->base + self->position + scanned + offset);
+                break;
+            }
+
+            if (left >= length) {
+                next = available - length + 1;
+            }
+        }
+
+        if (seekable) {
+            self->position += next;
+            scanned = 0;
+        }
+        else {
+            scanned = next;
+        }
+
+        int const more = ensure(L, self, self->size - self->position + 1);
+
+        if (more < 0) {
+            set_position(self, saved);
+            self->bit = bit;
+            return out_of_memory(L);
+        }
+        else if (more == 0) {
+            break;
+        }
+    }
+
+    if (!set_position(self, saved)) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid position: %I", (lua_Integer)saved);
+        return 2;
+    }
+
+    self->bit = bit;
+
+    if (found < 0) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_pushinteger(L, found);
+    return 1;
+}
+
+static int l_find(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+    size_t length = 0;
+    char const* const needle = luaL_checklstring(L, 2, &length);
+
+    if (self->source != NULL) {
+        return find_stream(L, self, (uint8_t const*)needle, length);
+    }
+
+    size_t init = 0;
+
+    if (!check_init(L, self, 3, &init)) {
+        return 2;
+    }
+
+    uint8_t const* const data = (uint8_t const*)self->data + init;
+    size_t const size = self->size - init;
+    size_t const offset = find(data, size, (uint8_t const*)needle, length);
+
+    if (offset == size && length != 0) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_pushinteger(L, (lua_Integer)(init + offset));
+    return 1;
+}
+
+static int l_count(lua_State* const L) {
+    Buffer const* const self = check(L, 1);
+
+    if (self->source != NULL) {
+        return unsupported_on_stream(L);
+    }
+
+    lua_Integer byte = 0;
+
+    if (lua_type(L, 2) == LUA_TSTRING) {
+        size_t length = 0;
+        char const* const string = lua_tolstring(L, 2, &length);
+        luaL_argcheck(L, length == 1, 2, "string must have one character");
+        byte = (uint8_t)string[0];
+    }
+    else {
+        byte = luaL_checkinteger(L, 2);
+        luaL_argcheck(L, byte >= 0 && byte <= 255, 2, "byte must be between 0 and 255");
+    }
+
+    size_t init = 0;
+
+    if (!check_init(L, self, 3, &init)) {
+        return 2;
+    }
+
+    uint8_t const* const data = (uint8_t const*)self->data + init;
+    lua_pushinteger(L, (lua_Integer)count(data, self->size - init, (uint8_t)byte));
+    return 1;
+}
+
+static int l_lines_iterator(lua_State* const L) {
+    Buffer* const self = check(L, lua_upvalueindex(1));
+
+    if (read_line(L, self) != 1) {
+        return lua_error(L);
+    }
+
+    return 1;
+}
+
+static int l_lines(lua_State* const L) {
+    check(L, 1);
+    lua_settop(L, 1);
+    lua_pushcclosure(L, l_lines_iterator, 1);
+    return 1;
+}
+
+/* Gets the optional range [begin, end) of positions, defaulting to the entire buffer */
+static int check_range(lua_State* const L, Buffer const* const self, int const index, size_t* const begin, size_t* const end) {
+    lua_Integer const first = luaL_optinteger(L, index, 0);
+    lua_Integer const last = luaL_optinteger(L, index + 1, (lua_Integer)self->size);
+
+    if (first < 0 || first > last || (size_t)last > self->size) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid limits: %I and %I", first, last);
+        return 0;
+    }
+
+    *begin = (size_t)first;
+    *end = (size_t)last;
+    return 1;
+}
+
+static int l_utf8_valid(lua_State* const L) {
+    Buffer const* const self = check(L, 1);
+    size_t begin = 0, end = 0;
+
+    if (self->source != NULL) {
+        return unsupported_on_stream(L);
+    }
+
+    if (!check_range(L, self, 2, &begin, &end)) {
+        return 2;
+    }
+
+    size_t const offset = utf8_check((uint8_t const*)self->data + begin, end - begin);
+
+    if (offset != end - begin) {
+        lua_pushboolean(L, 0);
+        lua_pushinteger(L, (lua_Integer)(begin + offset));
+        return 2;
+    }
+
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+static int l_utf8_len(lua_State* const L) {
+    Buffer const* const self = check(L, 1);
+    size_t begin = 0, end = 0;
+
+    if (self->source != NULL) {
+        return unsupported_on_stream(L);
+    }
+
+    if (!check_range(L, self, 2, &begin, &end)) {
+        return 2;
+    }
+
+    uint8_t const* const data = (uint8_t const*)self->data + begin;
+    size_t const offset = utf8_check(data, end - begin);
+
+    if (offset != end - begin) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid UTF-8 sequence at position: %I", (lua_Integer)(begin + offset));
+        return 2;
+    }
+
+    lua_pushinteger(L, (lua_Integer)utf8_count(data, end - begin));
+    return 1;
+}
+
+static int l_hex(lua_State* const L) {
+    Buffer const* const self = check(L, 1);
+    size_t begin = 0, end = 0;
+
+    if (self->source != NULL) {
+        return unsupported_on_stream(L);
+    }
+
+    if (!check_range(L, self, 2, &begin, &end)) {
+        return 2;
+    }
+
+    size_t const size = end - begin;
+
+    if (size > (SIZE_MAX - 1) / 2) {
+        return out_of_memory(L);
+    }
+
+    luaL_Buffer result;
+    char* const dst = luaL_buffinitsize(L, &result, size * 2);
+    hex_encode(dst, (uint8_t const*)self->data + begin, size);
+    luaL_pushresultsize(&result, size * 2);
+    return 1;
+}
+
+static int l_base64(lua_State* const L) {
+    Buffer const* const self = check(L, 1);
+    size_t begin = 0, end = 0;
+
+    if (self->source != NULL) {
+        return unsupported_on_stream(L);
+    }
+
+    if (!check_range(L, self, 2, &begin, &end)) {
+        return 2;
+    }
+
+    size_t const size = end - begin;
+
+    if (size / 3 > (SIZE_MAX - 4) / 4) {
+        return out_of_memory(L);
+    }
+
+    size_t const length = (size + 2) / 3 * 4;
+    luaL_Buffer result;
+    char* const dst = luaL_buffinitsize(L, &result, length);
+    base64_encode(dst, (uint8_t const*)self->data + begin, size);
+    luaL_pushresultsize(&result, length);
+    return 1;
+}
+
+static int l_codepoints_iterator(lua_State* const L) {
+    Buffer const* const self = check(L, lua_upvalueindex(1));
+    size_t const position = (size_t)lua_tointeger(L, lua_upvalueindex(2));
+    size_t const end = (size_t)lua_tointeger(L, lua_upvalueindex(3));
+
+    if (position >= end) {
+        return 0;
+    }
+
+    uint32_t codepoint = 0;
+    size_t const length = utf8_decode((uint8_t const*)self->data + position, end - position, &codepoint);
+
+    if (length == 0) {
+        return luaL_error(L, "invalid UTF-8 sequence at position: %I", (lua_Integer)position);
+    }
+
+    lua_pushinteger(L, (lua_Integer)(position + length));
+    lua_replace(L, lua_upvalueindex(2));
+
+    lua_pushinteger(L, (lua_Integer)position);
+    lua_pushinteger(L, (lua_Integer)codepoint);
+    return 2;
+}
+
+static int l_codepoints(lua_State* const L) {
+    Buffer const* const self = check(L, 1);
+    size_t begin = 0, end = 0;
+
+    if (self->source != NULL) {
+        return unsupported_on_stream(L);
+    }
+
+    if (!check_range(L, self, 2, &begin, &end)) {
+        return 2;
+    }
+
+    lua_settop(L, 1);
+    lua_pushinteger(L, (lua_Integer)begin);
+    lua_pushinteger(L, (lua_Integer)end);
+    lua_pushcclosure(L, l_codepoints_iterator, 3);
+    return 1;
+}
+
+static int l_unpack(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+    Layout const* const layout = (Layout*)luaL_checkudata(L, 2, LAYOUT_MT);
+
+    if (!layout->variable && ensure(L, self, layout->size) < 0) {
+        return out_of_memory(L);
+    }
+
+    size_t const position = self->position;
+
+    if (!layout->variable && layout->size > self->size - position) {
+        return invalid_position(L, self, position);
+    }
+
+    size_t const start = self->base + position;
+    unsigned const bit = self->bit;
+
+    luaL_checkstack(L, (int)layout->count, "too many fields in layout");
+
+    for (size_t i = 0; i < layout->count; i++) {
+        Field const* const field = layout->fields + i;
+        int pushed = 0;
+
+        if (field->mode == MODE_LENGTH) {
+            pushed = read_string(L, self, field->length);
+        }
+        else {
+            pushed = read_value(L, self, field->mode);
+        }
+
+        if (pushed != 1) {
+            // Restore the position, nil and the error message are at the top of the stack.
+            set_position(self, start);
+            self->bit = bit;
+            return 2;
+        }
+    }
+
+    return (int)layout->count;
+}
+
+/* Decodes n elements in native order from src into the table at the top of the stack */
+#define DECODE_ARRAY(type, push_value) \
+    for (size_t i = 0; i < n; i++) { \
+        type value; \
+        memcpy(&value, src + i * sizeof(value), sizeof(value)); \
+        push_value(L, value); \
+        lua_rawseti(L, -2, index++); \
+    }
+
+static int l_read_array(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+    size_t mode_len = 0;
+    char const* const mode = luaL_checklstring(L, 2, &mode_len);
+    lua_Integer const count = luaL_checkinteger(L, 3);
+
+    uint32_t const mode_hash = hash_mode(mode, mode_len);
+    int const width = mode_size(mode_hash);
+
+    if (width <= 0) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid mode: \"%s\"", mode);
+        return 2;
+    }
+
+    if (count < 0 || (size_t)count > SIZE_MAX / width) {
+        return invalid_position(L, self, self->position);
+    }
+
+    if (ensure(L, self, (size_t)count * width) < 0) {
+        return out_of_memory(L);
+    }
+
+    size_t const position = self->position;
+
+    if ((size_t)count > (self->size - position) / width) {
+        return invalid_position(L, self, position);
+    }
+
+    lua_createtable(L, count < INT_MAX ? (int)count : INT_MAX, 0);
+
+    uint8_t const* data = (uint8_t const*)self->data + position;
+    int const swap = width > 1 && mode_is_be(mode_hash) == is_le();
+
+    // Decode in blocks, byte-swapping each block into native order when needed.
+    uint64_t block[512];
+    size_t const block_count = sizeof(block) / width;
+    lua_Integer index = 1;
+
+    for (size_t left = (size_t)count; left != 0;) {
+        size_t const n = left < block_count ? left : block_count;
+        uint8_t const* src = data;
+
+        if (swap) {
+            swap_bytes((uint8_t*)block, data, n, width);
+            src = (uint8_t const*)block;
+        }
+
+        switch (mode_hash) {
+            case MODE_SB:
+            case MODE_UB:
+                for (size_t i = 0; i < n; i++) {
+                    lua_pushinteger(L, src[i]);
+                    lua_rawseti(L, -2, index++);
+                }
+
+                break;
+
+            // Values are returned the same way buffer.read does.
+            case MODE_SWL: case MODE_SWB:
+            case MODE_UWL: case MODE_UWB: DECODE_ARRAY(uint16_t, lua_pushinteger); break;
+            case MODE_SDL: case MODE_SDB:
+            case MODE_UDL: case MODE_UDB: DECODE_ARRAY(uint32_t, lua_pushinteger); break;
+            case MODE_SQL: case MODE_SQB: DECODE_ARRAY(int64_t, lua_pushinteger); break;
+            case MODE_UQL: case MODE_UQB: DECODE_ARRAY(uint64_t, lua_pushinteger); break;
+            case MODE_FL:  case MODE_FB:  DECODE_ARRAY(float, lua_pushnumber); break;
+            case MODE_DL:  case MODE_DB:  DECODE_ARRAY(double, lua_pushnumber); break;
+        }
+
+        data += n * width;
+        left -= n;
+    }
+
+    self->position = position + (size_t)count * width;
+    self->bit = 0;
+    return 1;
+}
+
+#undef DECODE_ARRAY
+
+/*
+Reads up to 57 bits, loading the next 8 bytes at once into an accumulator and
+taking the bits from it. Returns 0 if there aren't enough bytes left, and -1 if
+the window of a streaming buffer couldn't grow.
+*/
+static int read_bits(lua_State* const L, Buffer* const self, unsigned const count, int const lsb, uint64_t* const value) {
+    unsigned const total = self->bit + count;
+
+    if (ensure(L, self, 8) < 0) {
+        return -1;
+    }
+
+    size_t const available = self->size - self->position;
+
+    if ((total + 7) / 8 > available) {
+        return 0;
+    }
+
+    uint8_t const* const data = (uint8_t const*)self->data + self->position;
+    uint64_t word = 0;
+
+    if (available >= 8) {
+        if (lsb) {
+            word = (uint64_t)data[0] | (uint64_t)data[1] << 8 | (uint64_t)data[2] << 16 |
+                   (uint64_t)data[3] << 24 | (uint64_t)data[4] << 32 | (uint64_t)data[5] << 40 |
+                   (uint64_t)data[6] << 48 | (uint64_t)data[7] << 56;
+        }
+        else {
+            word = (uint64_t)data[0] << 56 | (uint64_t)data[1] << 48 | (uint64_t)data[2] << 40 |
+                   (uint64_t)data[3] << 32 | (uint64_t)data[4] << 24 | (uint64_t)data[5] << 16 |
+                   (uint64_t)data[6] << 8 | (uint64_t)data[7];
+        }
+    }
+    else {
+        // Near the end of the buffer, the missing bytes are zero.
+        for (size_t i = 0; i < available; i++) {
+            word |= (uint64_t)data[i] << (lsb ? i * 8 : 56 - i * 8);
+        }
+    }
+
+    if (count == 0) {
+        *value = 0;
+    }
+    else if (lsb) {
+        *value = (word >> self->bit) & ((UINT64_C(1) << count) - 1);
+    }
+    else {
+        *value = (word << self->bit) >> (64 - count);
+    }
+
+    self->position += total / 8;
+    self->bit = total % 8;
+    return 1;
+}
+
+static int l_bits(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+    lua_Integer const count = luaL_checkinteger(L, 2);
+    char const* const order = luaL_optstring(L, 3, "msb");
+
+    luaL_argcheck(L, count >= 0 && count <= 64, 2, "bit count must be between 0 and 64");
+
+    int lsb = 0;
+
+    if (strcmp(order, "lsb") == 0) {
+        lsb = 1;
+    }
+    else if (strcmp(order, "msb") != 0) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid bit order: \"%s\"", order);
+        return 2;
+    }
+
+    size_t const start = self->base + self->position;
+    unsigned const bit = self->bit;
+    uint64_t value = 0;
+
+    if (count <= 57) {
+        int const res = read_bits(L, self, (unsigned)count, lsb, &value);
+
+        if (res <= 0) {
+            return res < 0 ? out_of_memory(L) : invalid_position(L, self, self->position);
+        }
+    }
+    else {
+        // Too many bits for the accumulator, read them in two parts.
+        uint64_t first = 0, second = 0;
+        int res = read_bits(L, self, 32, lsb, &first);
+
+        if (res > 0) {
+            res = read_bits(L, self, (unsigned)count - 32, lsb, &second);
+        }
+
+        if (res <= 0) {
+            set_position(self, start);
+            self->bit = bit;
+            return res < 0 ? out_of_memory(L) : invalid_position(L, self, self->position);
+        }
+
+        value = lsb ? first | second << 32 : first << (count - 32) | second;
+    }
+
+    lua_pushinteger(L, (lua_Integer)value);
+    return 1;
+}
+
+static int l_align(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+
+    if (self->bit != 0) {
+        self->position++;
+        self->bit = 0;
+    }
+
+    lua_pushinteger(L, (lua_Integer)(self->base + self->position));
+    return 1;
+}
+
+/* Loads a value with width bytes from data */
+static uint64_t load_value(uint8_t const* const data, size_t const width, int const be) {
+    uint64_t value = 0;
+
+    if (be) {
+        for (size_t i = 0; i < width; i++) {
+            value = value << 8 | data[i];
+        }
+    }
+    else {
+        for (size_t i = 0; i < width; i++) {
+            value |= (uint64_t)data[i] << (i * 8);
+        }
+    }
+
+    return value;
+}
+
+static int l_decode_columns(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+    Layout const* const layout = (Layout*)luaL_checkudata(L, 2, LAYOUT_MT);
+    lua_Integer const count = luaL_checkinteger(L, 3);
+
+    if (layout->variable) {
+        lua_pushnil(L);
+        lua_pushliteral(L, "layout has fields with a variable size");
+        return 2;
+    }
+
+    if (count < 0 || (layout->size != 0 && (size_t)count > SIZE_MAX / layout->size)) {
+        return invalid_position(L, self, self->position);
+    }
+
+    size_t const total = (size_t)count * layout->size;
+
+    if (ensure(L, self, total) < 0) {
+        return out_of_memory(L);
+    }
+
+    if (total > self->size - self->position) {
+        return invalid_position(L, self, self->position);
+    }
+
+    if (layout->count == 0) {
+        // No arrays to fill, don't loop over the records.
+        self->position += total;
+        self->bit = 0;
+        return 0;
+    }
+
+    luaL_checkstack(L, (int)layout->count + 1, "too many fields in layout");
+
+    // One array per field, filled with all the records in a single pass over the data.
+    int const first = lua_gettop(L) + 1;
+    int const hint = count < INT_MAX ? (int)count : INT_MAX;
+
+    for (size_t i = 0; i < layout->count; i++) {
+        lua_createtable(L, hint, 0);
+    }
+
+    uint8_t const* data = (uint8_t const*)self->data + self->position;
+    size_t left = self->size - self->position;
+
+    for (lua_Integer record = 1; record <= count; record++) {
+        for (size_t i = 0; i < layout->count; i++) {
+            Field const* const field = layout->fields + i;
+
+            // The fields add up to the layout size checked above, but never read past the data.
+            if (field->length > left) {
+                lua_settop(L, first - 1);
+                return invalid_position(L, self, self->position);
+            }
+
+            left -= field->length;
+
+            if (field->mode == MODE_LENGTH) {
+                lua_pushlstring(L, (char const*)data, field->length);
+            }
+            else {
+                push_value(L, field->mode, load_value(data, field->length, mode_is_be(field->mode)));
+            }
+
+            lua_rawseti(L, first + (int)i, record);
+            data += field->length;
+        }
+    }
+
+    self->position += total;
+    self->bit = 0;
+    return (int)layout->count;
+}
+
+static int l_seek(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+    lua_Integer const offset = luaL_checkinteger(L, 2);
+    char const* const whence = luaL_optstring(L, 3, "set");
+
+    lua_Integer position = 0;
+
+    if (strcmp(whence, "set") == 0) {
+        position = offset;
+    }
+    else if (strcmp(whence, "cur") == 0) {
+        position = (lua_Integer)(self->base + self->position) + offset;
+    }
+    else if (strcmp(whence, "end") == 0) {
+        lua_Integer size = (lua_Integer)self->size;
+
+        if (self->source != NULL && (size = stream_size(self)) < 0) {
+            lua_pushnil(L);
+            lua_pushliteral(L, "error getting the stream size");
+            return 2;
+        }
+
+        position = size - offset;
+    }
+    else {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid seek mode: \"%s\"", whence);
+        return 2;
+    }
+
+    if (position < 0 || !set_position(self, (size_t)position)) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid seek position: %I", position);
+        return 2;
+    }
+
+    lua_pushinteger(L, position);
+    return 1;
+}
+
+static int l_tell(lua_State* const L) {
+    Buffer const* const self = check(L, 1);
+    lua_pushinteger(L, (lua_Integer)(self->base + self->position));
+    return 1;
+}
+
+static int l_size(lua_State* const L) {
+    Buffer const* const self = check(L, 1);
+
+    if (self->source != NULL) {
+        lua_Integer const size = stream_size(self);
+
+        if (size < 0) {
+            lua_pushnil(L);
+            lua_pushliteral(L, "error getting the stream size");
+            return 2;
+        }
+
+        lua_pushinteger(L, size);
+        return 1;
+    }
+
+    lua_pushinteger(L, self->size);
+    return 1;
+}
+
+static int l_sub(lua_State* const L) {
     Buffer const* const self = check(L, 1);
-    lua_pushinteger(L, self->position);
+    lua_Integer const begin = luaL_checkinteger(L, 2);
+    lua_Integer const size = luaL_checkinteger(L, 3);
+
+    if (self->source != NULL) {
+        return unsupported_on_stream(L);
+    }
+
+    if (begin < 0 || begin + size >= self->size) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid limits: %I and %I", begin, size);
+        return 2;
+    }
+
+    return push(L, ((uint8_t const*)self->data) + begin, size, 1);
+}
+
+static int l_tostring(lua_State* const L) {
+    Buffer const* const self = (Buffer*)lua_touserdata(L, 1);
+
+    if (self->source != NULL) {
+        lua_pushfstring(L, "Buffer (stream): %p", self);
+        return 1;
+    }
+
+    lua_pushlstring(L, (char const*)self->data, self->size);
+    return 1;
+}
+
+#ifdef BUFFER_SHARE
+/*
+ * Shared contents with a handle, so that handles can be checked before being used. Handles are
+ * never reused, so a stale handle can't import other contents that happen to be allocated at the
+ * same address.
+ */
+static Shared* handles = NULL;
+static uint64_t last_handle = 0;
+static char handles_lock = 0;
+
+static void lock_handles(void) {
+    while (__atomic_test_and_set(&handles_lock, __ATOMIC_ACQUIRE)) {
+        // Spin, the lock is only held to walk the list.
+    }
+}
+
+static void unlock_handles(void) {
+    __atomic_clear(&handles_lock, __ATOMIC_RELEASE);
+}
+
+/* Returns the link to the shared contents of handle, which points to NULL if it's not a handle */
+static Shared** find_handle(uint64_t const handle) {
+    Shared** link = &handles;
+
+    while (*link != NULL && (*link)->handle != handle) {
+        link = &(*link)->next;
+    }
+
+    return link;
+}
+
+static void release(Shared* const shared) {
+    long refs = __atomic_load_n(&shared->refs, __ATOMIC_RELAXED);
+
+    // Drop references that aren't the last one without taking the lock.
+    while (refs > 1) {
+        if (__atomic_compare_exchange_n(&shared->refs, &refs, refs - 1, 0, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+
+    // The last reference is dropped with the lock held, so that buffer.import can't find the
+    // contents while they're freed.
+    lock_handles();
+
+    if (__atomic_sub_fetch(&shared->refs, 1, __ATOMIC_ACQ_REL) != 0) {
+        unlock_handles();
+        return;
+    }
+
+    if (shared->handle != 0) {
+        Shared** const link = find_handle(shared->handle);
+        *link = shared->next;
+    }
+
+    unlock_handles();
+
+    if (shared->mapped) {
+#ifdef BUFFER_MMAP
+        munmap((void*)shared->data, shared->size);
+#endif
+    }
+    else {
+        free(shared->owned);
+    }
+
+    free(shared);
+}
+#endif
+
+static int l_gc(lua_State* const L) {
+    Buffer const* const self = (Buffer*)lua_touserdata(L, 1);
+
+#ifdef BUFFER_SHARE
+    if (self->shared != NULL) {
+        release(self->shared);
+    }
+#endif
+
+    if (self->parent_ref != LUA_NOREF) {
+        luaL_unref(L, LUA_REGISTRYINDEX, self->parent_ref);
+
+        if (self->source != NULL) {
+            // The window is owned by the buffer, the stream by its parent.
+            free((void*)self->data);
+        }
+    }
+    else if (self->mapped) {
+#ifdef BUFFER_MMAP
+        munmap((void*)self->data, self->size);
+#endif
+    }
+    else if (self->shared == NULL) {
+        free((void*)self->data);
+    }
+
+    return 0;
+}
+
+static int push(lua_State* const L, void const* const data, size_t const length, int const parent_index) {
+    Buffer* const self = (Buffer*)lua_newuserdata(L, sizeof(*self));
+
+    self->data = data;
+    self->size = length;
+    self->position = 0;
+    self->mapped = 0;
+    self->bit = 0;
+    self->shared = NULL;
+    self->source = NULL;
+    self->handle = NULL;
+    self->base = 0;
+    self->capacity = 0;
+
+    if (parent_index != 0) {
+        lua_pushvalue(L, parent_index);
+        self->parent_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    }
+    else {
+        self->parent_ref = LUA_NOREF;
+    }
+
+    if (luaL_newmetatable(L, BUFFER_MT)) {
+        static const luaL_Reg methods[] = {
+            {"read", l_read},
+            {"unpack", l_unpack},
+            {"decode_columns", l_decode_columns},
+            {"read_array", l_read_array},
+            {"read_varints", l_read_varints},
+            {"lines", l_lines},
+            {"bits", l_bits},
+            {"align", l_align},
+            {"find", l_find},
+            {"count", l_count},
+            {"utf8_valid", l_utf8_valid},
+            {"utf8_len", l_utf8_len},
+            {"codepoints", l_codepoints},
+            {"hex", l_hex},
+            {"base64", l_base64},
+            {"seek", l_seek},
+            {"tell", l_tell},
+            {"size", l_size},
+            {"sub",  l_sub},
+            {NULL,   NULL}
+        };
+
+        luaL_newlib(L, methods);
+        lua_setfield(L, -2, "__index");
+
+        lua_pushcfunction(L, l_tostring);
+        lua_setfield(L, -2, "__tostring");
+
+        lua_pushcfunction(L, l_gc);
+        lua_setfield(L, -2, "__gc");
+    }
+
+    lua_setmetatable(L, -2);
     return 1;
 }
 
-static int l_size(lua_State* const L) {
-    Buffer const* const self = check(L, 1);
-    lua_pushinteger(L, self->size);
+static int l_new(lua_State* const L) {
+    size_t length;
+    char const* const string = luaL_checklstring(L, 1, &length);
+
+    if (!lua_toboolean(L, 2)) {
+        // Lua strings are immutable and don't move, so point to the string and keep it alive.
+        return push(L, string, length, 1);
+    }
+
+    void* const data = malloc(length);
+
+    if (data == NULL) {
+        lua_pushnil(L);
+        lua_pushliteral(L, "out of memory");
+        return 2;
+    }
+
+    memcpy(data, string, length);
+    return push(L, data, length, 0);
+}
+
+static int l_mmap(lua_State* const L) {
+    char const* const path = luaL_checkstring(L, 1);
+
+#ifdef BUFFER_MMAP
+    // Don't block opening FIFOs, they're rejected below.
+    int const fd = open(path, O_RDONLY | O_NONBLOCK);
+
+    if (fd < 0) {
+        goto error;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0) {
+        int const saved = errno;
+        close(fd);
+        errno = saved;
+        goto error;
+    }
+
+    if (!S_ISREG(st.st_mode)) {
+        close(fd);
+        lua_pushnil(L);
+        lua_pushfstring(L, "%s: not a regular file", path);
+        return 2;
+    }
+
+    size_t const length = (size_t)st.st_size;
+
+    if (length == 0) {
+        // Empty files can't be mapped.
+        close(fd);
+        return push(L, NULL, 0, 0);
+    }
+
+    void* const data = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    int const saved = errno;
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        errno = saved;
+        goto error;
+    }
+
+    push(L, data, length, 0);
+    ((Buffer*)lua_touserdata(L, -1))->mapped = 1;
     return 1;
+#else
+    // No mmap, read the file into memory.
+    FILE* const file = fopen(path, "rb");
+
+    if (file == NULL) {
+        goto error;
+    }
+
+    long length = -1;
+
+    if (fseek(file, 0, SEEK_END) == 0) {
+        length = ftell(file);
+    }
+
+    if (length < 0 || fseek(file, 0, SEEK_SET) != 0) {
+        int const saved = errno;
+        fclose(file);
+        errno = saved;
+        goto error;
+    }
+
+    void* const data = malloc(length);
+
+    if (data == NULL && length != 0) {
+        fclose(file);
+        lua_pushnil(L);
+        lua_pushliteral(L, "out of memory");
+        return 2;
+    }
+
+    if (fread(data, 1, length, file) != (size_t)length) {
+        free(data);
+        fclose(file);
+        lua_pushnil(L);
+        lua_pushfstring(L, "%s: read error", path);
+        return 2;
+    }
+
+    fclose(file);
+    return push(L, data, length, 0);
+#endif
+
+error:
+    lua_pushnil(L);
+    lua_pushfstring(L, "%s: %s", path, strerror(errno));
+    return 2;
 }
 
-static int l_sub(lua_State* const L) {
-    Buffer const* const self = check(L, 1);
-    lua_Integer const begin = luaL_checkinteger(L, 2);
-    lua_Integer const size = luaL_checkinteger(L, 3);
+static int l_stream(lua_State* const L) {
+    Source const* source = &reader_source;
+    void* handle = NULL;
 
-    if (begin < 0 || begin + size >= self->size) {
+    if (lua_type(L, 1) != LUA_TFUNCTION) {
+        handle = luaL_testudata(L, 1, LUA_FILEHANDLE);
+
+        if (handle != NULL) {
+            luaL_argcheck(L, ((luaL_Stream*)handle)->closef != NULL, 1, "attempt to use a closed file");
+            source = &file_source;
+        }
+        else {
+#ifdef BUFFER_LUAIO
+            handle = luaio_Check(L, 1);
+            source = &stream_source;
+#else
+            return luaL_argerror(L, 1, "file or function expected");
+#endif
+        }
+    }
+
+    lua_Integer const window = luaL_optinteger(L, 2, BUFFER_WINDOW);
+    luaL_argcheck(L, window > 0, 2, "window size must be positive");
+
+    void* const data = malloc((size_t)window);
+
+    if (data == NULL) {
         lua_pushnil(L);
-        lua_pushfstring(L, "invalid limits: %I and %I", begin, size);
+        lua_pushliteral(L, "out of memory");
         return 2;
     }
 
-    return push(L, ((uint8_t const*)self->data) + begin, size, 1);
+    push(L, data, 0, 1);
+    Buffer* const self = (Buffer*)lua_touserdata(L, -1);
+    self->source = source;
+    self->handle = handle;
+
+    // Positions are offsets in the stream, starting where it currently is.
+    long const offset = source->tell(self);
+    self->base = offset > 0 ? (size_t)offset : 0;
+    self->capacity = (size_t)window;
+    return 1;
 }
 
-static int l_tostring(lua_State* const L) {
-    Buffer const* const self = (Buffer*)lua_touserdata(L, 1);
-    lua_pushlstring(L, (char const*)self->data, self->size);
+#ifdef BUFFER_SHARE
+static int invalid_handle(lua_State* const L) {
+    lua_pushnil(L);
+    lua_pushliteral(L, "invalid handle");
+    return 2;
+}
+
+static int l_share(lua_State* const L) {
+    Buffer* const self = check(L, 1);
+
+    if (self->source != NULL) {
+        return unsupported_on_stream(L);
+    }
+
+    if (self->shared == NULL) {
+        Shared* shared = NULL;
+
+        if (self->parent_ref == LUA_NOREF) {
+            // The buffer owns its contents, hand them over without copying.
+            shared = (Shared*)malloc(sizeof(*shared));
+
+            if (shared == NULL) {
+                goto oom;
+            }
+
+            shared->data = self->data;
+            shared->mapped = self->mapped;
+            shared->owned = self->mapped ? NULL : (void*)self->data;
+            self->mapped = 0;
+        }
+        else {
+            // The contents belong to a Lua value of this state, copy them once. The parent is kept
+            // alive since buffers created with sub may point into it.
+            shared = (Shared*)malloc(sizeof(*shared) + self->size);
+
+            if (shared == NULL) {
+                goto oom;
+            }
+
+            memcpy(shared->bytes, self->data, self->size);
+            shared->data = shared->bytes;
+            shared->mapped = 0;
+            shared->owned = NULL;
+            self->data = shared->bytes;
+        }
+
+        shared->refs = 1;
+        shared->size = self->size;
+        shared->handle = 0;
+        shared->next = NULL;
+        self->shared = shared;
+    }
+
+    // The handle doesn't hold a reference, the contents are freed with the last buffer using them.
+    Shared* const shared = self->shared;
+    lock_handles();
+
+    if (shared->handle == 0) {
+        shared->handle = ++last_handle;
+        shared->next = handles;
+        handles = shared;
+    }
+
+    uint64_t const handle = shared->handle;
+    unlock_handles();
+
+    lua_pushinteger(L, (lua_Integer)handle);
     return 1;
+
+oom:
+    lua_pushnil(L);
+    lua_pushliteral(L, "out of memory");
+    return 2;
 }
 
-static int l_gc(lua_State* const L) {
-    Buffer const* const self = (Buffer*)lua_touserdata(L, 1);
+static int l_import(lua_State* const L) {
+    uint64_t const handle = (uint64_t)luaL_checkinteger(L, 1);
 
-    if (self->parent_ref == LUA_NOREF) {
-        free((void*)self->data);
+    // Create the buffer first so that a memory error doesn't leak the reference.
+    push(L, NULL, 0, 0);
+    Buffer* const self = (Buffer*)lua_touserdata(L, -1);
+
+    lock_handles();
+    Shared* const shared = handle != 0 ? *find_handle(handle) : NULL;
+
+    if (shared != NULL) {
+        __atomic_add_fetch(&shared->refs, 1, __ATOMIC_RELAXED);
     }
-    else {
-        luaL_unref(L, LUA_REGISTRYINDEX, self->parent_ref);
+
+    unlock_handles();
+
+    if (shared == NULL) {
+        return invalid_handle(L);
     }
 
-    return 0;
+    self->data = shared->data;
+    self->size = shared->size;
+    self->shared = shared;
+    return 1;
 }
 
-static int push(lua_State* const L, void const* const data, size_t const length, int const parent_index) {
-    Buffer* const self = (Buffer*)lua_newuserdata(L, sizeof(*self));
+static int l_release(lua_State* const L) {
+    uint64_t const handle = (uint64_t)luaL_checkinteger(L, 1);
+
+    // Only the handle is invalidated, buffers using the contents are unaffected.
+    lock_handles();
+    Shared** const link = handle != 0 ? find_handle(handle) : NULL;
+    Shared* const shared = link != NULL ? *link : NULL;
+
+    if (shared != NULL) {
+        *link = shared->next;
+        shared->handle = 0;
+    }
+
+    unlock_handles();
+
+    if (shared == NULL) {
+        return invalid_handle(L);
+    }
+
+    lua_pushboolean(L, 1);
+    return 1;
+}
+#endif
+
+static int l_from_base64(lua_State* const L) {
+    size_t length = 0;
+    char const* const string = luaL_checklstring(L, 1, &length);
+
+    // Padding is optional, but if present the length must be a multiple of 4.
+    size_t digits = length;
+
+    if (length % 4 == 0) {
+        digits -= digits > 0 && string[digits - 1] == '=';
+        digits -= digits > 0 && string[digits - 1] == '=';
+    }
+
+    uint8_t* const data = (uint8_t*)malloc(digits / 4 * 3 + 4 + 2);
+
+    if (data == NULL) {
+        return out_of_memory(L);
+    }
+
+    size_t error = 0;
+    size_t const size = base64_decode(data, string, digits, &error);
+
+    if (error != SIZE_MAX) {
+        free(data);
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid base64 digit at position: %I", (lua_Integer)error);
+        return 2;
+    }
+
+    return push(L, data, size, 0);
+}
+
+static Builder* check_builder(lua_State* const L, int const index) {
+    return (Builder*)luaL_checkudata(L, index, BUILDER_MT);
+}
+
+/* Makes room for extra bytes, growing the capacity geometrically */
+static int reserve(Builder* const self, size_t const extra) {
+    if (extra <= self->capacity - self->size) {
+        return 1;
+    }
+
+    if (extra > SIZE_MAX - self->size) {
+        return 0;
+    }
+
+    size_t const needed = self->size + extra;
+    size_t capacity = self->capacity < 64 ? 64 : self->capacity;
+
+    while (capacity < needed) {
+        capacity = capacity > SIZE_MAX / 2 ? needed : capacity * 2;
+    }
+
+    uint8_t* const data = (uint8_t*)realloc(self->data, capacity);
+
+    if (data == NULL) {
+        return 0;
+    }
 
     self->data = data;
-    self->size = length;
-    self->position = 0;
+    self->capacity = capacity;
+    return 1;
+}
 
-    if (parent_index != 0) {
-        lua_pushvalue(L, parent_index);
-        self->parent_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+static int l_builder_write(lua_State* const L) {
+    Builder* const self = check_builder(L, 1);
+    size_t mode_len = 0;
+    char const* const mode = luaL_checklstring(L, 2, &mode_len);
+
+    uint32_t const mode_hash = hash_mode(mode, mode_len);
+    int const width = mode_size(mode_hash);
+
+    if (width <= 0) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "invalid mode: \"%s\"", mode);
+        return 2;
+    }
+
+    uint64_t value = 0;
+
+    switch (mode_hash) {
+        case MODE_FL:
+        case MODE_FB: {
+            union {
+                float f;
+                uint32_t u32;
+            }
+            conv;
+
+            conv.f = (float)luaL_checknumber(L, 3);
+            value = conv.u32;
+            break;
+        }
+
+        case MODE_DL:
+        case MODE_DB: {
+            union {
+                double d;
+                uint64_t u64;
+            }
+            conv;
+
+            conv.d = (double)luaL_checknumber(L, 3);
+            value = conv.u64;
+            break;
+        }
+
+        default:
+            value = (uint64_t)luaL_checkinteger(L, 3);
+            break;
+    }
+
+    if (!reserve(self, width)) {
+        return out_of_memory(L);
+    }
+
+    uint8_t* const data = self->data + self->size;
+
+    if (mode_is_be(mode_hash)) {
+        for (int i = 0; i < width; i++) {
+            data[i] = (uint8_t)(value >> ((width - 1 - i) * 8));
+        }
     }
     else {
-        self->parent_ref = LUA_NOREF;
+        for (int i = 0; i < width; i++) {
+            data[i] = (uint8_t)(value >> (i * 8));
+        }
     }
 
-    if (luaL_newmetatable(L, BUFFER_MT)) {
+    self->size += width;
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int l_builder_bytes(lua_State* const L) {
+    Builder* const self = check_builder(L, 1);
+    size_t length = 0;
+    char const* const string = luaL_checklstring(L, 2, &length);
+
+    if (!reserve(self, length)) {
+        return out_of_memory(L);
+    }
+
+    memcpy(self->data + self->size, string, length);
+    self->size += length;
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int l_builder_size(lua_State* const L) {
+    Builder const* const self = check_builder(L, 1);
+    lua_pushinteger(L, self->size);
+    return 1;
+}
+
+static int l_builder_finish(lua_State* const L) {
+    Builder* const self = check_builder(L, 1);
+    int const as_string = lua_toboolean(L, 2);
+
+    uint8_t* const data = self->data;
+    size_t const size = self->size;
+
+    // The builder starts over empty.
+    self->data = NULL;
+    self->size = 0;
+    self->capacity = 0;
+
+    if (as_string) {
+        lua_pushlstring(L, (char const*)data, size);
+        free(data);
+        return 1;
+    }
+
+    // The buffer takes ownership of the memory, no copies are made.
+    return push(L, data, size, 0);
+}
+
+static int l_builder_gc(lua_State* const L) {
+    Builder* const self = (Builder*)lua_touserdata(L, 1);
+    free(self->data);
+    return 0;
+}
+
+static int l_builder(lua_State* const L) {
+    lua_Integer const capacity = luaL_optinteger(L, 1, 0);
+    luaL_argcheck(L, capacity >= 0, 1, "capacity must be non-negative");
+
+    Builder* const self = (Builder*)lua_newuserdata(L, sizeof(*self));
+    self->data = NULL;
+    self->size = 0;
+    self->capacity = 0;
+
+    if (luaL_newmetatable(L, BUILDER_MT)) {
         static const luaL_Reg methods[] = {
-            {"read", l_read},
-            {"seek", l_seek},
-            {"tell", l_tell},
-            {"size", l_size},
-            {"sub",  l_sub},
-            {NULL,   NULL}
+            {"write",  l_builder_write},
+            {"bytes",  l_builder_bytes},
+            {"size",   l_builder_size},
+            {"finish", l_builder_finish},
+            {NULL,     NULL}
         };
 
         luaL_newlib(L, methods);
         lua_setfield(L, -2, "__index");
 
-        lua_pushcfunction(L, l_tostring);
-        lua_setfield(L, -2, "__tostring");
-
-        lua_pushcfunction(L, l_gc);
+        lua_pushcfunction(L, l_builder_gc);
         lua_setfield(L, -2, "__gc");
     }
 
     lua_setmetatable(L, -2);
+
+    if (capacity != 0 && !reserve(self, (size_t)capacity)) {
+        return out_of_memory(L);
+    }
+
     return 1;
 }
 
-static int l_new(lua_State* const L) {
-    size_t length;
-    char const* const string = luaL_checklstring(L, 1, &length);
+static int l_compile(lua_State* const L) {
+    char const* const layout_str = luaL_checkstring(L, 1);
+    size_t count = 0;
 
-    void* const data = malloc(length);
+    for (char const* k = layout_str; *k != 0;) {
+        if (isspace((unsigned char)*k)) {
+            k++;
+            continue;
+        }
 
-    if (data == NULL) {
+        count++;
+
+        while (*k != 0 && !isspace((unsigned char)*k)) {
+            k++;
+        }
+    }
+
+    Layout* const layout = (Layout*)lua_newuserdata(L, sizeof(*layout) + count * sizeof(layout->fields[0]));
+    layout->count = count;
+    layout->size = 0;
+    layout->variable = 0;
+
+    Field* field = layout->fields;
+
+    for (char const* k = layout_str; *k != 0;) {
+        if (isspace((unsigned char)*k)) {
+            k++;
+            continue;
+        }
+
+        char const* const begin = k;
+
+        while (*k != 0 && !isspace((unsigned char)*k)) {
+            k++;
+        }
+
+        if (isdigit((unsigned char)*begin)) {
+            char* end = NULL;
+            errno = 0;
+            unsigned long long const length = strtoull(begin, &end, 10);
+
+            if (end != k) {
+                goto invalid_mode;
+            }
+
+            if (errno == ERANGE || length > SIZE_MAX) {
+                goto too_large;
+            }
+
+            field->mode = MODE_LENGTH;
+            field->length = (size_t)length;
+        }
+        else {
+            field->mode = hash_mode(begin, k - begin);
+            int const size = mode_size(field->mode);
+
+            if (size < 0) {
+                goto invalid_mode;
+            }
+
+            field->length = (size_t)size;
+            layout->variable |= size == 0;
+        }
+
+        if (field->length > SIZE_MAX - layout->size) {
+            goto too_large;
+        }
+
+        layout->size += field->length;
+        field++;
+        continue;
+
+invalid_mode:
+        lua_pushlstring(L, begin, k - begin);
         lua_pushnil(L);
-        lua_pushliteral(L, "out of memory");
+        lua_pushfstring(L, "invalid mode: \"%s\"", lua_tostring(L, -2));
+        return 2;
+
+too_large:
+        lua_pushnil(L);
+        lua_pushliteral(L, "layout too large");
         return 2;
     }
 
-    memcpy(data, string, length);
-    return push(L, data, length, 0);
+    if (luaL_newmetatable(L, LAYOUT_MT)) {
+        lua_pushliteral(L, "Layout");
+        lua_setfield(L, -2, "__name");
+    }
+
+    lua_setmetatable(L, -2);
+    return 1;
 }
 
 LUAMOD_API int luaopen_buffer(lua_State* const L) {
     static const luaL_Reg functions[] = {
         {"new", l_new},
+        {"mmap", l_mmap},
+        {"compile", l_compile},
+        {"builder", l_builder},
+        {"from_base64", l_from_base64},
+        {"stream", l_stream},
+#ifdef BUFFER_SHARE
+        {"share", l_share},
+        {"import", l_import},
+        {"release", l_release},
+#endif
         {NULL,  NULL}
     };
 
     static struct {char const* const name; char const* const value;} const info[] = {
         {"_COPYRIGHT", "Copyright (c) 2021-2022 Andre Leiradella"},
         {"_LICENSE", "MIT"},
-        {"_VERSION", "1.0.0"},
+        {"_VERSION", "1.1.0"},
         {"_NAME", "buffer"},
         {"_URL", "https://github.com/leiradel/luamods/buffer"},
         {"_DESCRIPTION", "Creates a read-only binary array from a string, and allows reads of data types from it"}
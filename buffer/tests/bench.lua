@@ -0,0 +1,152 @@
+-- Measures the cost of the buffer read modes, seek, and sub on inputs of
+-- several sizes. Results are written to stdout as CSV, one line per benchmark
+-- and input size, so runs can be compared with other tools.
+--
+-- Usage: lua bench.lua [size...]
+
+local buffer = require 'buffer'
+
+local sizes = {}
+
+for i = 1, #arg do
+    sizes[i] = assert(math.tointeger(tonumber(arg[i])), 'sizes must be integers')
+end
+
+if #sizes == 0 then
+    sizes = {4 * 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024}
+end
+
+-- Minimum time spent on each benchmark, runs are repeated until it's reached
+local min_time = 0.2
+
+local function bench(name, size, ops, bytes, func)
+    collectgarbage()
+    collectgarbage()
+
+    local runs = 0
+    local t0 = os.clock()
+    local elapsed = 0
+
+    repeat
+        func()
+        runs = runs + 1
+        elapsed = os.clock() - t0
+    until elapsed >= min_time
+
+    local total_ops = ops * runs
+    local total_bytes = bytes * runs
+
+    print(string.format('%s,%d,%d,%.3f,%.3f', name, size, total_ops, elapsed * 1e9 / total_ops, total_bytes / elapsed / 1e9))
+end
+
+-------------------------------------------------------------------------------
+-- Inputs
+
+local function binary(size)
+    local block = {}
+
+    for i = 1, 4096 do
+        block[i] = string.char((i * 2654435761 >> 13) & 255)
+    end
+
+    block = table.concat(block)
+    return (string.rep(block, size // #block + 1)):sub(1, size)
+end
+
+local function text(size)
+    local lines = {}
+    local length = 0
+    local i = 0
+
+    while length < size do
+        local line = string.format('%08d the quick brown fox jumps over %d lazy dogs\n', i, i % 97)
+        lines[#lines + 1] = line
+        length = length + #line
+        i = i + 1
+    end
+
+    return (table.concat(lines)):sub(1, size)
+end
+
+-------------------------------------------------------------------------------
+-- Benchmarks
+
+local modes = {
+    {'sb', 1}, {'ub', 1},
+    {'swl', 2}, {'swb', 2}, {'uwl', 2}, {'uwb', 2},
+    {'sdl', 4}, {'sdb', 4}, {'udl', 4}, {'udb', 4},
+    {'sql', 8}, {'sqb', 8}, {'uql', 8}, {'uqb', 8},
+    {'fl', 4}, {'fb', 4}, {'dl', 8}, {'db', 8}
+}
+
+local lengths = {1, 16, 256, 4096}
+
+print('benchmark,size,ops,ns_per_op,gb_per_s')
+
+for _, size in ipairs(sizes) do
+    local buf = assert(buffer.new(binary(size)))
+    local read, seek = buf.read, buf.seek
+
+    for _, mode in ipairs(modes) do
+        local name, width = mode[1], mode[2]
+        local ops = size // width
+
+        bench('read ' .. name, size, ops, ops * width, function()
+            seek(buf, 0)
+
+            for i = 1, ops do
+                read(buf, name)
+            end
+        end)
+    end
+
+    for _, length in ipairs(lengths) do
+        local ops = size // length
+
+        if ops > 0 then
+            bench('read ' .. length, size, ops, ops * length, function()
+                seek(buf, 0)
+
+                for i = 1, ops do
+                    read(buf, length)
+                end
+            end)
+        end
+    end
+
+    do
+        local ops = 100000
+
+        bench('seek', size, ops, 0, function()
+            for i = 1, ops do
+                seek(buf, (i * 7919) % size)
+            end
+        end)
+    end
+
+    do
+        local ops = 100000
+        local sub = buf.sub
+        local length = size // 2
+
+        bench('sub', size, ops, 0, function()
+            for i = 1, ops do
+                sub(buf, i % length, length)
+            end
+        end)
+    end
+
+    local contents = text(size)
+    local lines = assert(buffer.new(contents))
+    local count = select(2, contents:gsub('\n', ''))
+
+    if contents:sub(-1) ~= '\n' then
+        count = count + 1
+    end
+
+    bench('read *l', size, count, size, function()
+        seek(lines, 0)
+
+        while read(lines, '*l') do end
+    end)
+end
@@ -0,0 +1,1087 @@
+local buffer = require 'buffer'
+
+-- Writes data to a temporary file and returns it positioned at the start.
+local function tmpfile(data)
+    local file = assert(io.tmpfile())
+    assert(file:write(data))
+    assert(file:seek('set', 0))
+    return file
+end
+
+-- Returns a reader function that returns data in chunks of at most size bytes,
+-- and nil after stop bytes.
+local function reader(data, size, stop)
+    local position = 1
+    stop = stop or #data
+
+    return function(count)
+        if position > stop then
+            return nil
+        end
+
+        local chunk = data:sub(position, math.min(position + math.min(count, size) - 1, stop))
+        position = position + #chunk
+        return chunk
+    end
+end
+
+-------------------------------------------------------------------------------
+-- Reads
+
+do
+    local buf = assert(buffer.new('\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8'))
+
+    -- Only the signed quad words are negative.
+    assert(buf:read('sb') == 0xff and buf:read('ub') == 0xfe)
+    assert(buf:seek(0) == 0 and buf:read('swl') == 0xfeff and buf:read('swb') == 0xfdfc)
+    assert(buf:seek(0) == 0 and buf:read('sdl') == 0xfcfdfeff and buf:read('sdb') == 0xfbfaf9f8)
+    assert(buf:seek(0) == 0 and buf:read('sql') == string.unpack('<i8', '\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8'))
+    assert(buf:seek(0) == 0 and buf:read('sqb') == string.unpack('>i8', '\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8'))
+    assert(buf:seek(0) == 0 and buf:read('fl') == string.unpack('<f', '\xff\xfe\xfd\xfc'))
+    assert(buf:read('db') == nil and buf:tell() == 4)
+    assert(buf:read('ud') == string.unpack('=I4', '\xfb\xfa\xf9\xf8'))
+
+    local value, err = buf:read('xyz')
+    assert(value == nil and err == 'invalid mode: "xyz"')
+    assert(buf:read(-1) == nil and buf:read(1) == nil and buf:read(0) == '')
+end
+
+-------------------------------------------------------------------------------
+-- Varints
+
+do
+    local function uleb(n)
+        local bytes = {}
+
+        repeat
+            local byte = n & 0x7f
+            n = n >> 7
+            bytes[#bytes + 1] = string.char(n ~= 0 and byte | 0x80 or byte)
+        until n == 0
+
+        return table.concat(bytes)
+    end
+
+    local function sleb(n)
+        local bytes = {}
+
+        while true do
+            local byte = n & 0x7f
+            n = n // 128
+
+            if (n == 0 and byte & 0x40 == 0) or (n == -1 and byte & 0x40 ~= 0) then
+                bytes[#bytes + 1] = string.char(byte)
+                return table.concat(bytes)
+            end
+
+            bytes[#bytes + 1] = string.char(byte | 0x80)
+        end
+    end
+
+    local function zleb(n)
+        return uleb((n << 1) ~ (n < 0 and -1 or 0))
+    end
+
+    local encoders = {uleb = uleb, sleb = sleb, zleb = zleb}
+
+    local values = {
+        0, 1, 63, 64, 127, 128, 150, 8191, 8192, 16383, 16384, 1 << 31, (1 << 53) + 1, (1 << 56) - 1, 1 << 56,
+        (1 << 63) - 1, math.mininteger, -1, -2, -63, -64, -65, -8192, -8193, -(1 << 56), 0x123456789abcdef
+    }
+
+    -- The largest unsigned value.
+    assert(uleb(-1) == '\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01')
+    assert(buffer.new(uleb(-1)):read('uleb') == -1)
+    assert(buffer.new('\x01'):read('zleb') == -1 and buffer.new('\x03'):read('zleb') == -2)
+    assert(buffer.new(zleb(math.mininteger)):read('zleb') == math.mininteger)
+
+    for mode, encode in pairs(encoders) do
+        local all = {}
+
+        for _, value in ipairs(values) do
+            local encoded = encode(value)
+            all[#all + 1] = encoded
+
+            -- Alone, so the bytes are decoded one at a time, and followed by more bytes.
+            for _, s in ipairs{encoded, encoded .. '\0\0\0\0\0\0\0\0\0\0'} do
+                local buf = assert(buffer.new(s))
+                assert(buf:read(mode) == value, mode .. ' ' .. value)
+                assert(buf:tell() == #encoded)
+            end
+        end
+
+        local buf = assert(buffer.new('x' .. table.concat(all)))
+        assert(buf:read(1) == 'x')
+        local array = assert(buf:read_varints(#values, mode))
+
+        for i, value in ipairs(values) do
+            assert(array[i] == value, mode .. ' ' .. value)
+        end
+
+        assert(buf:read('ub') == nil)
+    end
+
+    -- Non-minimal encodings are fine as long as they have at most 10 bytes.
+    assert(buffer.new('\x80\x00'):read('uleb') == 0)
+    assert(buffer.new('\x80\x80\x80\x80\x80\x80\x80\x80\x80\x00'):read('uleb') == 0)
+
+    -- More than 10 bytes.
+    for _, s in ipairs{'\x80\x80\x80\x80\x80\x80\x80\x80\x80\x80\x00', string.rep('\xff', 20)} do
+        local buf = assert(buffer.new('abc' .. s))
+        assert(buf:read(3) == 'abc')
+        local value, err = buf:read('uleb')
+        assert(value == nil and err == 'invalid varint at position: 3')
+        assert(buf:tell() == 3)
+    end
+
+    -- Truncated.
+    for _, s in ipairs{'\x80', '\xff\xff', '\x80\x80\x80\x80\x80\x80\x80\x80\x80'} do
+        local buf = assert(buffer.new('abc' .. s))
+        assert(buf:read(3) == 'abc')
+        local value, err = buf:read('sleb')
+        assert(value == nil and err == 'invalid position: 3')
+        assert(buf:tell() == 3)
+    end
+
+    -- Errors in batches leave the read position unchanged.
+    local buf = assert(buffer.new('\x01\x02\x03\x80'))
+    local value, err = buf:read_varints(4)
+    assert(value == nil and err == 'invalid position: 3')
+    assert(buf:tell() == 0)
+    value, err = buf:read_varints(5)
+    assert(value == nil and err == 'invalid position: 0')
+    assert(buf:read_varints(-1) == nil)
+    value, err = buf:read_varints(1, 'ub')
+    assert(value == nil and err == 'invalid mode: "ub"')
+    assert(#assert(buf:read_varints(0)) == 0)
+
+    buf = assert(buffer.new('\x01' .. string.rep('\x80', 11) .. '\x00'))
+    value, err = buf:read_varints(2, 'zleb')
+    assert(value == nil and err == 'invalid varint at position: 1')
+    assert(buf:tell() == 0)
+
+    local array = assert(buf:read_varints(1, 'zleb'))
+    assert(#array == 1 and array[1] == -1 and buf:tell() == 1)
+end
+
+-------------------------------------------------------------------------------
+-- Layouts
+
+do
+    local header = assert(buffer.compile('  udb\tuwl  3 sb fl   '))
+    local s = string.pack('>I4<I2', 0x12345678, 0xabcd) .. 'abc\x80' .. string.pack('<f', 1.5)
+    local buf = assert(buffer.new(s .. s))
+
+    -- Layouts can be reused.
+    for i = 1, 2 do
+        local a, b, c, d, e = buf:unpack(header)
+        assert(a == 0x12345678 and b == 0xabcd and c == 'abc' and d == 0x80 and e == 1.5)
+        assert(buf:tell() == i * #s)
+    end
+
+    -- Not enough data, the read position is left unchanged.
+    assert(buf:seek(#s + 1) == #s + 1)
+    local value, err = buf:unpack(header)
+    assert(value == nil and err == 'invalid position: ' .. #s + 1)
+    assert(buf:tell() == #s + 1)
+
+    -- Lines make the size variable.
+    local lines = assert(buffer.compile('*l ub *l'))
+    buf = assert(buffer.new('first\n\x07second'))
+    local first, byte, second = buf:unpack(lines)
+    assert(first == 'first' and byte == 7 and second == 'second')
+    assert(buf:seek(0) == 0 and buf:unpack(assert(buffer.compile('*l 8'))) == nil and buf:tell() == 0)
+
+    -- Empty layouts.
+    assert(select('#', buf:unpack(assert(buffer.compile('')))) == 0)
+    assert(select('#', buf:unpack(assert(buffer.compile(' \t ')))) == 0)
+
+    -- Invalid layouts.
+    for layout, mode in pairs{['udb xyz'] = 'xyz', ['3x'] = '3x', ['udb -1'] = '-1', ['l'] = 'l', ['1.5'] = '1.5'} do
+        local value, err = buffer.compile(layout)
+        assert(value == nil and err == 'invalid mode: "' .. mode .. '"', layout)
+    end
+
+    -- Sizes that don't fit.
+    for _, layout in ipairs{'18446744073709551615 ub', '99999999999999999999999', '9223372036854775807 9223372036854775807 2', 'ub 18446744073709551615'} do
+        local value, err = buffer.compile(layout)
+        assert(value == nil and err == 'layout too large', layout)
+    end
+
+    assert(buffer.compile('18446744073709551614 ub') ~= nil)
+    assert(buffer.new('abc'):unpack(buffer.compile('18446744073709551614 ub')) == nil)
+    assert(not pcall(buf.unpack, buf, 'ub'))
+end
+
+-------------------------------------------------------------------------------
+-- Columns
+
+do
+    local record = assert(buffer.compile('udb swl 3 sb dl'))
+    local parts = {}
+
+    for i = 1, 50 do
+        parts[i] = string.pack('>I4<i2', i * 0x01020304, -i) .. string.char(65 + i % 26):rep(3) .. string.pack('<i1<d', -i, i / 8)
+    end
+
+    local s = table.concat(parts)
+
+    -- The same values as unpacking one record at a time.
+    for _, count in ipairs{0, 1, 2, 49} do
+        for _, start in ipairs{0, 1} do
+            local buf = assert(buffer.new('\0' .. s))
+            assert(buf:seek(start) == start)
+            local columns = {assert(buf:decode_columns(record, count))}
+            local after = buf:tell()
+            assert(#columns == 5 and after == start + count * 18)
+
+            assert(buf:seek(start) == start)
+
+            for i = 1, count do
+                local values = {buf:unpack(record)}
+
+                for j = 1, 5 do
+                    assert(#columns[j] == count and columns[j][i] == values[j], j)
+                end
+            end
+
+            assert(buf:tell() == after)
+        end
+    end
+
+    -- Not enough data, including a buffer that ends in the middle of a record, leaves the read
+    -- position unchanged.
+    for _, size in ipairs{0, 1, 17, 18, 19, 99} do
+        local buf = assert(buffer.new(s:sub(1, size)))
+        local count = size // 18 + 1
+        local value, err = buf:decode_columns(record, count)
+        assert(value == nil and err == 'invalid position: 0', size)
+        assert(buf:tell() == 0)
+        assert(#assert(buf:decode_columns(record, count - 1)) == count - 1)
+    end
+
+    local buf = assert(buffer.new(s))
+    assert(buf:seek(#s - 30) == #s - 30)
+    assert(buf:decode_columns(record, 2) == nil and buf:tell() == #s - 30)
+    assert(#assert(buf:decode_columns(record, 1)) == 1 and buf:tell() == #s - 12)
+
+    -- Counts and layouts whose total size overflows.
+    buf = assert(buffer.new(s))
+    local huge = assert(buffer.compile('18446744073709551614 ub'))
+
+    for _, args in ipairs{{huge, 1}, {huge, 2}, {record, math.maxinteger}, {record, math.maxinteger // 10}, {record, -1}} do
+        local value, err = buf:decode_columns(args[1], args[2])
+        assert(value == nil and err == 'invalid position: 0')
+        assert(buf:tell() == 0)
+    end
+
+    assert(buffer.compile('9223372036854775807 9223372036854775807 2') == nil)
+
+    -- Empty layouts return nothing, whatever the count.
+    assert(select('#', assert(buffer.compile(''))) == 1)
+    assert(select('#', buf:decode_columns(assert(buffer.compile('')), math.maxinteger)) == 0)
+
+    -- Only fixed-size layouts.
+    for _, layout in ipairs{'ub *l', 'uleb', 'udb zleb'} do
+        local value, err = buf:decode_columns(assert(buffer.compile(layout)), 1)
+        assert(value == nil and err == 'layout has fields with a variable size')
+    end
+
+    -- Records spanning refills of streaming buffers.
+    buf = assert(buffer.stream(reader(s, 7), 16))
+    local columns = {assert(buf:decode_columns(record, 50))}
+    assert(columns[1][50] == 50 * 0x01020304 and columns[5][50] == 50 / 8)
+    assert(buf:decode_columns(record, 1) == nil)
+end
+
+-------------------------------------------------------------------------------
+-- Find and count
+
+do
+    local function find(s, needle, init)
+        local found = s:find(needle, init + 1, true)
+        return found and found - 1
+    end
+
+    local function count(s, byte, init)
+        local _, n = s:sub(init + 1):gsub(byte:gsub('%W', '%%%0'), '')
+        return n
+    end
+
+    local parts = {}
+
+    for i = 1, 600 do
+        parts[#parts + 1] = i % 7 == 0 and 'abab' or string.char(97 + i % 5)
+    end
+
+    local s = table.concat(parts)
+    local buf = assert(buffer.new(s))
+    local needles = {'a', 'ab', 'aba', 'abab', 'ababa', 'ba', 'eab', 'abcde', 'zz', s:sub(100, 140), s}
+
+    -- Against string.find at every init, so matches start in and cross the 16-byte blocks.
+    for _, needle in ipairs(needles) do
+        for init = 0, #s do
+            assert(buf:find(needle, init) == find(s, needle, init), needle .. ' at ' .. init)
+        end
+    end
+
+    -- Overlapping matches.
+    buf = assert(buffer.new(string.rep('a', 40)))
+    assert(buf:find('aaa') == 0 and buf:find('aaa', 1) == 1 and buf:find('aaa', 37) == 37)
+    assert(buf:find('aaa', 38) == nil)
+
+    -- Empty needles are found at init, needles longer than the buffer are never found.
+    assert(buf:find('') == 0 and buf:find('', 17) == 17 and buf:find('', 40) == 40)
+    assert(buf:find(string.rep('a', 41)) == nil)
+    assert(buffer.new(''):find('') == 0 and buffer.new(''):find('a') == nil)
+
+    -- The read position is the default init, and isn't changed.
+    assert(buf:seek(30) == 30 and buf:find('a') == 30 and buf:tell() == 30)
+
+    local value, err = buf:find('a', 41)
+    assert(value == nil and err == 'invalid position: 41')
+    assert(buf:find('a', -1) == nil)
+
+    -- Counts, over more than the 255 16-byte blocks counted at once.
+    local long = s:rep(10)
+    buf = assert(buffer.new(long))
+
+    for _, byte in ipairs{'a', 'b', 'e', 'z', '\0'} do
+        for _, init in ipairs{0, 1, 15, 16, 17, 4079, 4080, 4081, #long - 17, #long - 1, #long} do
+            assert(buf:count(byte, init) == count(long, byte, init), byte .. ' at ' .. init)
+        end
+
+        assert(buf:count(byte:byte()) == count(long, byte, 0))
+    end
+
+    -- Runs of the same byte count every byte.
+    assert(buffer.new(string.rep('\xff', 5000)):count(255) == 5000)
+    assert(buffer.new(string.rep('\xff', 5000)):count('\xff', 4999) == 1)
+    assert(buffer.new(''):count('a') == 0)
+
+    assert(buf:count('a', #long + 1) == nil)
+    assert(not pcall(buf.count, buf, 'ab'))
+    assert(not pcall(buf.count, buf, 256))
+    assert(not pcall(buf.count, buf, -1))
+
+    -- Matches that cross the window of streaming buffers.
+    for _, window in ipairs{1, 2, 3, 16, 17} do
+        for _, needle in ipairs{'abab', 'ababa', 'eab', s:sub(100, 140)} do
+            for _, init in ipairs{0, 5, 16, 333} do
+                local stream = assert(buffer.stream(tmpfile(s), window))
+                assert(stream:find(needle, init) == find(s, needle, init), needle .. ' in ' .. window)
+                assert(stream:tell() == 0)
+            end
+        end
+    end
+
+    value, err = assert(buffer.stream(tmpfile(s))):count('a')
+    assert(value == nil and err == 'operation not supported on streaming buffers')
+end
+
+-------------------------------------------------------------------------------
+-- Arrays
+
+do
+    local bytes = {}
+    local seed = 7
+
+    for i = 1, 10000 do
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        bytes[i] = string.char(seed >> 16 & 255)
+    end
+
+    local s = table.concat(bytes)
+
+    local modes = {
+        'sb', 'ub', 'swl', 'swb', 'uwl', 'uwb', 'sdl', 'sdb', 'udl', 'udb', 'sql', 'sqb', 'uql', 'uqb',
+        'fl', 'fb', 'dl', 'db', 'sw', 'uw', 'sd', 'ud', 'sq', 'uq', 'f', 'd'
+    }
+
+    local function same(a, b)
+        return a == b or (a ~= a and b ~= b)
+    end
+
+    -- The same values as reading one at a time, for counts around the 16-byte blocks
+    -- that are byte-swapped at once and the 4 KiB blocks that are decoded at once,
+    -- and at unaligned positions.
+    for _, mode in ipairs(modes) do
+        for _, count in ipairs{0, 1, 2, 7, 8, 9, 17, 100, 511, 512, 513, 1100} do
+            for _, start in ipairs{0, 1, 3} do
+                local buf = assert(buffer.new(s))
+                assert(buf:seek(start) == start)
+                local array = assert(buf:read_array(mode, count))
+                local after = buf:tell()
+                assert(#array == count)
+
+                assert(buf:seek(start) == start)
+
+                for i = 1, count do
+                    assert(same(array[i], buf:read(mode)), mode)
+                end
+
+                assert(buf:tell() == after)
+            end
+        end
+    end
+
+    -- Not enough data, the read position is left unchanged.
+    local buf = assert(buffer.new(s:sub(1, 15)))
+    assert(buf:read('ub') == s:byte(1))
+
+    for _, mode in ipairs{'ub', 'uwl', 'udb', 'sq', 'd'} do
+        local value, err = buf:read_array(mode, 15)
+        assert(value == nil and err == 'invalid position: 1', mode)
+        assert(buf:tell() == 1)
+    end
+
+    assert(#assert(buf:read_array('uwb', 7)) == 7 and buf:tell() == 15)
+    assert(#assert(buf:read_array('uqb', 0)) == 0)
+    assert(buf:read_array('ub', 1) == nil)
+    assert(buf:read_array('ub', -1) == nil)
+    assert(buf:read_array('ub', math.maxinteger) == nil)
+
+    -- Only fixed-size data types.
+    for _, mode in ipairs{'*l', 'uleb', 'xyz'} do
+        local value, err = buf:read_array(mode, 1)
+        assert(value == nil and err == 'invalid mode: "' .. mode .. '"')
+    end
+end
+
+-------------------------------------------------------------------------------
+-- Bits
+
+do
+    local bytes = {}
+    local seed = 11
+
+    for i = 1, 2000 do
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        bytes[i] = string.char(seed >> 16 & 255)
+    end
+
+    local s = table.concat(bytes)
+
+    -- Reads count bits one at a time, returning the value and the new bit offset.
+    local function bits(offset, count, lsb)
+        local value = 0
+
+        for i = 0, count - 1 do
+            local byte = s:byte(offset // 8 + 1)
+            local bit = offset % 8
+
+            if lsb then
+                value = value | ((byte >> bit) & 1) << i
+            else
+                value = value << 1 | ((byte >> (7 - bit)) & 1)
+            end
+
+            offset = offset + 1
+        end
+
+        return value, offset
+    end
+
+    -- Random counts crossing byte boundaries, including 0 and 64 bits.
+    for _, order in ipairs{'msb', 'lsb'} do
+        local buf = assert(buffer.new(s))
+        local offset = 0
+        seed = 3
+
+        while offset + 64 <= #s * 8 do
+            seed = (seed * 1103515245 + 12345) & 0x7fffffff
+            local count = seed >> 16 & 63
+
+            if count == 63 then
+                count = 64
+            end
+
+            local expected
+            expected, offset = bits(offset, count, order == 'lsb')
+            assert(buf:bits(count, order) == expected, order)
+            assert(buf:tell() == offset // 8)
+        end
+    end
+
+    -- 64-bit reads at every bit offset.
+    for skip = 0, 7 do
+        for _, order in ipairs{'msb', 'lsb'} do
+            local buf = assert(buffer.new(s))
+            assert(buf:bits(skip, order) == bits(0, skip, order == 'lsb'))
+            assert(buf:bits(64, order) == bits(skip, 64, order == 'lsb'))
+            assert(buf:tell() == 8)
+        end
+    end
+
+    local buf = assert(buffer.new('\xff\xff\xff\xff\xff\xff\xff\xff'))
+    assert(buf:bits(64) == -1 and buf:tell() == 8)
+
+    -- The msb example from the README, and the default order.
+    buf = assert(buffer.new('\xa5'))
+    assert(buf:bits(3) == 5 and buf:bits(5) == 5)
+
+    buf = assert(buffer.new('\xa5'))
+    assert(buf:bits(3, 'lsb') == 5 and buf:bits(5, 'lsb') == 20)
+
+    -- align skips the rest of a partially read byte, and does nothing otherwise.
+    buf = assert(buffer.new('\xab\xcd\xef\x12'))
+    assert(buf:align() == 0)
+    assert(buf:bits(4) == 0xa and buf:tell() == 0)
+    assert(buf:align() == 1 and buf:align() == 1)
+    assert(buf:bits(8) == 0xcd and buf:align() == 2)
+    assert(buf:bits(12) == 0xef1 and buf:align() == 4)
+
+    -- Byte reads start at the byte holding the next unread bit and discard the
+    -- bits left in it.
+    buf = assert(buffer.new('\xab\xcd\xef\x12'))
+    assert(buf:bits(4) == 0xa)
+    assert(buf:read('ub') == 0xab and buf:tell() == 1)
+    assert(buf:bits(4) == 0xc)
+    assert(buf:read('uwb') == 0xcdef and buf:tell() == 3)
+    assert(buf:bits(4, 'lsb') == 0x2 and buf:bits(4, 'lsb') == 0x1)
+    assert(buf:tell() == 4)
+
+    buf = assert(buffer.new('\xab\xcd\xef\x12'))
+    assert(buf:bits(1) == 1)
+    assert(buf:read(2) == '\xab\xcd' and buf:bits(8) == 0xef)
+    assert(buf:bits(1) == 0)
+    assert(#assert(buf:read_array('ub', 1)) == 1 and buf:bits(0) == 0 and buf:tell() == 4)
+
+    buf = assert(buffer.new('\xab\xcd\xef\x12'))
+    assert(buf:bits(3) == 5 and buf:seek(1) == 1 and buf:bits(4) == 0xc)
+
+    -- Reading past the end fails leaving the position and the bit offset unchanged.
+    for _, count in ipairs{21, 33, 57, 58, 64} do
+        for _, order in ipairs{'msb', 'lsb'} do
+            buf = assert(buffer.new(s:sub(1, 8)))
+            assert(buf:bits(4, order) == bits(0, 4, order == 'lsb'))
+            assert(buf:bits(40, order) == bits(4, 40, order == 'lsb'))
+
+            local value, err = buf:bits(count, order)
+            assert(value == nil and err == 'invalid position: 5', count)
+            assert(buf:tell() == 5)
+            assert(buf:bits(20, order) == bits(44, 20, order == 'lsb'))
+            assert(buf:bits(1, order) == nil and buf:tell() == 8)
+        end
+    end
+
+    -- The same when a byte read fails after a partial bits read.
+    buf = assert(buffer.new('\xab\xcd'))
+    assert(buf:bits(4) == 0xa)
+    assert(buf:read('udl') == nil and buf:read(3) == nil and buf:read_array('ub', 3) == nil)
+    assert(buf:unpack(assert(buffer.compile('ub ub ub'))) == nil)
+    assert(buf:unpack(assert(buffer.compile('ub uleb'))) == nil)
+    assert(buf:bits(4) == 0xb and buf:tell() == 1)
+
+    -- Invalid arguments.
+    buf = assert(buffer.new(s))
+    local value, err = buf:bits(1, 'xyz')
+    assert(value == nil and err == 'invalid bit order: "xyz"')
+    assert(not pcall(buf.bits, buf, -1))
+    assert(not pcall(buf.bits, buf, 65))
+    assert(buf:bits(0) == 0 and buf:tell() == 0)
+end
+
+-------------------------------------------------------------------------------
+-- Builders
+
+do
+    -- Each data type with a value that round trips, and its string.pack format.
+    local writes = {
+        {'sb', 0x7f, 'B'}, {'ub', 0xfe, 'B'},
+        {'swl', 0x1234, '<I2'}, {'swb', 0x1234, '>I2'}, {'uwl', 0xfedc, '<I2'}, {'uwb', 0xfedc, '>I2'},
+        {'sdl', 0x12345678, '<I4'}, {'sdb', 0x12345678, '>I4'}, {'udl', 0xfedcba98, '<I4'}, {'udb', 0xfedcba98, '>I4'},
+        {'sql', -2, '<i8'}, {'sqb', math.mininteger, '>i8'}, {'uql', 0x123456789abcdef0, '<i8'}, {'uqb', -1, '>i8'},
+        {'fl', 1.5, '<f'}, {'fb', -0.25, '>f'}, {'dl', math.pi, '<d'}, {'db', -math.huge, '>d'},
+        {'sw', 0x1234, '=I2'}, {'uw', 0xfedc, '=I2'}, {'sd', 0x12345678, '=I4'}, {'ud', 0xfedcba98, '=I4'},
+        {'sq', -3, '=i8'}, {'uq', 42, '=i8'}, {'f', 2.5, '=f'}, {'d', 1 / 3, '=d'}
+    }
+
+    -- Several rounds of all the data types, growing the builder well past its initial capacity.
+    for _, capacity in ipairs{0, 1, 4, 4096} do
+        local builder = buffer.builder(capacity)
+        local expected = {}
+
+        for round = 1, 20 do
+            for _, write in ipairs(writes) do
+                assert(builder:write(write[1], write[2]) == builder)
+                expected[#expected + 1] = string.pack(write[3], write[2])
+            end
+
+            assert(builder:bytes('round ' .. round) == builder)
+            expected[#expected + 1] = 'round ' .. round
+        end
+
+        expected = table.concat(expected)
+        assert(builder:size() == #expected)
+
+        local buf = builder:finish()
+        assert(tostring(buf) == expected and buf:size() == #expected)
+
+        for round = 1, 20 do
+            for _, write in ipairs(writes) do
+                assert(buf:read(write[1]) == write[2], write[1])
+            end
+
+            assert(buf:read(#('round ' .. round)) == 'round ' .. round)
+        end
+
+        assert(buf:read('ub') == nil)
+
+        -- The builder starts over empty, and can return strings.
+        assert(builder:size() == 0)
+        assert(builder:finish(true) == '')
+        assert(builder:write('uwb', 0x4142):bytes('C'):write('ub', 0x44):finish(true) == 'ABCD')
+        assert(builder:size() == 0 and builder:finish():size() == 0)
+    end
+
+    -- Values are truncated to the size of the data type.
+    local builder = buffer.builder()
+    builder:write('sb', -1):write('ub', 0x1ff):write('swl', -2):write('udb', -1)
+    assert(builder:finish(true) == '\xff\xff\xfe\xff\xff\xff\xff\xff')
+
+    -- Invalid data types and values.
+    for _, mode in ipairs{'*l', 'uleb', 'xyz'} do
+        local value, err = builder:write(mode, 1)
+        assert(value == nil and err == 'invalid mode: "' .. mode .. '"')
+    end
+
+    assert(not pcall(builder.write, builder, 'ub', 'x'))
+    assert(not pcall(builder.write, builder, 'ub', 1.5))
+    assert(not pcall(builder.bytes, builder, {}))
+    assert(not pcall(buffer.builder, -1))
+    assert(builder:size() == 0)
+end
+
+-------------------------------------------------------------------------------
+-- Mapped files
+
+do
+    local path = os.tmpname()
+    local contents = string.rep('mapped\n', 10000)
+
+    local function write(s)
+        local file = assert(io.open(path, 'wb'))
+        assert(file:write(s))
+        file:close()
+    end
+
+    write(contents)
+    local buf = assert(buffer.mmap(path))
+    assert(buf:size() == #contents and buf:read(#contents) == contents)
+    assert(buf:seek(7) == 7 and buf:read('*l') == 'mapped')
+    assert(buf:sub(14, 6):read(6) == 'mapped')
+
+    -- The buffer keeps its contents after the file is gone.
+    os.remove(path)
+    collectgarbage()
+    assert(buf:seek(0) == 0 and buf:read(#contents) == contents)
+
+    write('')
+    buf = assert(buffer.mmap(path))
+    assert(buf:size() == 0 and buf:read('ub') == nil)
+    os.remove(path)
+
+    local value, err = buffer.mmap(path)
+    assert(value == nil and err:sub(1, #path + 2) == path .. ': ')
+
+    -- Directories aren't regular files.
+    value, err = buffer.mmap('.')
+    assert(value == nil and err:sub(1, 3) == '.: ')
+end
+
+-------------------------------------------------------------------------------
+-- Streams
+
+local data = {}
+
+for i = 0, 999 do
+    data[#data + 1] = string.format('line %d\n', i)
+end
+
+data = table.concat(data)
+
+-- Seeking behind the discarded window reads the stream again.
+do
+    local buf = assert(buffer.stream(tmpfile(data), 16))
+    assert(buf:read(100) == data:sub(1, 100))
+    assert(buf:seek(3) == 3)
+    assert(buf:read(20) == data:sub(4, 23))
+    assert(buf:seek(10, 'end') == #data - 10)
+    assert(buf:read(10) == data:sub(-10))
+    assert(buf:read(1) == nil)
+    assert(buf:size() == #data)
+end
+
+-- Lines spanning refills, including a \r\n split by the window.
+do
+    local buf = assert(buffer.stream(tmpfile(data), 16))
+    local count = 0
+
+    for line in buf:lines() do
+        assert(line == string.format('line %d', count))
+        count = count + 1
+    end
+
+    assert(count == 1000)
+
+    buf = assert(buffer.stream(tmpfile('0123456789abcde\r\nnext\r\n'), 16))
+    assert(buf:read('*l') == '0123456789abcde')
+    assert(buf:read('*l') == 'next')
+    assert(buf:read('*l') == nil)
+end
+
+-- Matches spanning refills, on seekable and reader sources.
+do
+    local mem = assert(buffer.new(data))
+    local needles = {'line 0', 'line 1\nline 2', '7\nline 8', 'line 999\n', '\n', '', 'not there'}
+
+    for _, needle in ipairs(needles) do
+        for _, init in ipairs{0, 1, 15, 16, 17, 100, 5000, #data} do
+            local expected = mem:find(needle, init)
+
+            local buf = assert(buffer.stream(tmpfile(data), 16))
+            assert(buf:read(5) == data:sub(1, 5))
+            assert(buf:find(needle, init) == expected, needle)
+            assert(buf:tell() == 5)
+            assert(buf:read(5) == data:sub(6, 10))
+
+            buf = assert(buffer.stream(reader(data, 7), 16))
+            assert(buf:read(5) == data:sub(1, 5))
+            assert(buf:find(needle, init) == expected, needle)
+            assert(buf:tell() == 5)
+            assert(buf:read(5) == data:sub(6, 10))
+        end
+    end
+
+    -- Readers can't search behind the window.
+    local buf = assert(buffer.stream(reader(data, 7), 16))
+    assert(buf:read(100) == data:sub(1, 100))
+    assert(buf:read(100) == data:sub(101, 200))
+    local found, err = buf:find('line 0', 0)
+    assert(found == nil and err == 'invalid position: 0')
+    assert(buf:find('line 99') == 782)
+
+    -- Needles longer than the window make it grow.
+    buf = assert(buffer.stream(tmpfile(data), 16))
+    assert(buf:find(data:sub(500, 600)) == 499)
+end
+
+-- Arrays spanning refills.
+do
+    local values = {}
+
+    for i = 1, 100 do
+        values[i] = i * 1000
+    end
+
+    local packed = string.pack('<' .. string.rep('I4', #values), table.unpack(values))
+    local buf = assert(buffer.stream(tmpfile('xyz' .. packed), 16))
+    assert(buf:read(3) == 'xyz')
+
+    local array = assert(buf:read_array('udl', 100))
+
+    for i = 1, 100 do
+        assert(array[i] == values[i])
+    end
+
+    -- Not enough data, the read position is left unchanged.
+    buf = assert(buffer.stream(tmpfile('xyz' .. packed:sub(1, 397)), 16))
+    assert(buf:read(3) == 'xyz')
+    assert(buf:read_array('udl', 100) == nil)
+    assert(buf:tell() == 3)
+    assert(buf:read('udl') == values[1])
+end
+
+-- Readers that stop returning data partway through.
+do
+    local buf = assert(buffer.stream(reader(data, 5, 50), 16))
+    assert(buf:read(40) == data:sub(1, 40))
+    local value, err = buf:read(20)
+    assert(value == nil and err == 'invalid position: 40')
+    assert(buf:read(10) == data:sub(41, 50))
+
+    -- Readers can only seek within the window.
+    assert(buf:seek(45) == 45)
+    assert(buf:seek(0) == nil)
+    assert(buf:size() == nil)
+    assert(buf:read(5) == data:sub(46, 50))
+    assert(buf:read('ub') == nil)
+
+    -- Truncated files.
+    buf = assert(buffer.stream(tmpfile(data:sub(1, 30)), 16))
+    assert(buf:read(20) == data:sub(1, 20))
+    assert(buf:read('uql') == string.unpack('<i8', data, 21))
+    assert(buf:read('uql') == nil)
+    assert(buf:read(2) == data:sub(29, 30))
+
+    -- Invalid sources.
+    assert(not pcall(buffer.stream, 'data'))
+    assert(not pcall(buffer.stream, reader(data, 5), 0))
+
+    local file = tmpfile(data)
+    file:close()
+    assert(not pcall(buffer.stream, file))
+
+    buf = assert(buffer.stream(function() return 1 end))
+    assert(not pcall(buf.read, buf, 1))
+end
+
+-------------------------------------------------------------------------------
+-- Share
+
+if buffer.share then
+    -- Copied contents, imported twice.
+    local buf = assert(buffer.new('shared contents'))
+    local handle = assert(buffer.share(buf))
+    assert(math.type(handle) == 'integer')
+    local a = assert(buffer.import(handle))
+    local b = assert(buffer.import(handle))
+    assert(a:read(6) == 'shared' and b:read(15) == 'shared contents')
+    assert(a:tell() == 6 and buf:tell() == 0)
+
+    -- Imported buffers keep the contents alive after the shared buffer is collected.
+    buf, b = nil, nil
+    collectgarbage()
+    collectgarbage()
+
+    local c = assert(buffer.import(handle))
+    assert(c:read(15) == 'shared contents')
+    assert(buffer.release(handle) == true)
+
+    -- And after the handle is released.
+    collectgarbage()
+    assert(c:seek(7) == 7 and c:read(8) == 'contents')
+
+    -- Released handles are invalid, importing after release fails.
+    local value, err = buffer.import(handle)
+    assert(value == nil and err == 'invalid handle')
+    value, err = buffer.release(handle)
+    assert(value == nil and err == 'invalid handle')
+    assert(a:seek(0) == 0 and a:read(15) == 'shared contents')
+
+    -- Handles don't keep the contents alive, they're freed with the last buffer using them and
+    -- the handle becomes invalid without being released.
+    buf = assert(buffer.new('short lived'))
+    local stale = assert(buffer.share(buf))
+    assert(assert(buffer.import(stale)):read(5) == 'short')
+    buf = nil
+    collectgarbage()
+    collectgarbage()
+    value, err = buffer.import(stale)
+    assert(value == nil and err == 'invalid handle')
+
+    -- Stale handles never match contents shared later, even when they reuse the same memory.
+    for i = 1, 100 do
+        buf = assert(buffer.new('again ' .. i))
+        local fresh = assert(buffer.share(buf))
+        assert(fresh ~= stale and fresh ~= handle)
+        assert(buffer.import(stale) == nil and buffer.import(handle) == nil)
+        assert(assert(buffer.import(fresh)):read(6 + #tostring(i)) == 'again ' .. i)
+        buf = nil
+        collectgarbage()
+        assert(buffer.import(fresh) == nil)
+    end
+
+    -- Owned contents, shared twice, get the same handle until it's released.
+    local builder = buffer.builder()
+    buf = builder:bytes('owned'):finish()
+    local first = assert(buffer.share(buf))
+    assert(buffer.share(buf) == first)
+    assert(buffer.release(first))
+    assert(buffer.import(first) == nil)
+    local second = assert(buffer.share(buf))
+    assert(second ~= first)
+    assert(assert(buffer.import(second)):read(5) == 'owned')
+    assert(buffer.release(second))
+    assert(buffer.import(second) == nil)
+    assert(buf:read(5) == 'owned')
+
+    -- Bad handles.
+    for _, bad in ipairs{0, -1, math.maxinteger} do
+        value, err = buffer.import(bad)
+        assert(value == nil and err == 'invalid handle')
+        value, err = buffer.release(bad)
+        assert(value == nil and err == 'invalid handle')
+    end
+
+    assert(not pcall(buffer.import, 'handle'))
+    assert(not pcall(buffer.import, 1.5))
+    assert(not pcall(buffer.release))
+
+    -- Streaming buffers can't be shared.
+    assert(buffer.share(buffer.stream(reader('', 1))) == nil)
+end
+
+-------------------------------------------------------------------------------
+-- UTF-8
+
+-- Returns true, or false plus the position of the first invalid sequence, using
+-- Lua's own decoder, which rejects overlongs, surrogates, and values greater
+-- than 0x10ffff.
+local function utf8_valid(s)
+    local count, position = utf8.len(s)
+    return count ~= nil, position and position - 1
+end
+
+do
+    local sequences = {
+        -- Valid, at the limits of each length.
+        '\x7f', '\xc2\x80', '\xdf\xbf', '\xe0\xa0\x80', '\xed\x9f\xbf', '\xee\x80\x80', '\xef\xbf\xbf',
+        '\xf0\x90\x80\x80', '\xf4\x8f\xbf\xbf',
+        -- Overlongs.
+        '\xc0\x80', '\xc1\xbf', '\xe0\x80\x80', '\xe0\x9f\xbf', '\xf0\x80\x80\x80', '\xf0\x8f\xbf\xbf',
+        -- Surrogates.
+        '\xed\xa0\x80', '\xed\xbf\xbf',
+        -- Greater than 0x10ffff.
+        '\xf4\x90\x80\x80', '\xf5\x80\x80\x80', '\xf8\x88\x80\x80\x80', '\xff',
+        -- Truncated, and continuation bytes without a lead byte.
+        '\xc3', '\xe2\x82', '\xf0\x9f\x98', '\xe2\x28\xa1', '\x80', '\xbf\xbf',
+        -- Too long.
+        '\xc3\xa9\xa9'
+    }
+
+    for _, fill in ipairs{'a', '\xc3\xa9', '\xe2\x82\xac'} do
+        for _, sequence in ipairs(sequences) do
+            for pad = 0, 40 do
+                local prefix = fill:rep(pad // #fill) .. ('a'):rep(pad % #fill)
+
+                -- At the end of the input, including the end of 16- and 32-byte blocks when
+                -- #prefix + #sequence is 16 or 32, and followed by more text.
+                for _, s in ipairs{prefix .. sequence, prefix .. sequence .. fill:rep(8)} do
+                    local valid, position = utf8_valid(s)
+                    local buf = assert(buffer.new(s))
+                    local ok, at = buf:utf8_valid()
+                    assert(ok == valid and at == position, string.format('%q', s))
+
+                    if valid then
+                        assert(buf:utf8_len() == utf8.len(s))
+                    else
+                        local count, err = buf:utf8_len()
+                        assert(count == nil and err == 'invalid UTF-8 sequence at position: ' .. position)
+                    end
+                end
+            end
+        end
+    end
+
+    -- Ranges that cut a sequence.
+    local buf = assert(buffer.new('a\xe2\x82\xacb'))
+    assert(buf:utf8_valid(0, 5) == true)
+    assert(buf:utf8_valid(1, 4) == true)
+    assert(select(2, buf:utf8_valid(0, 3)) == 1)
+    assert(select(2, buf:utf8_valid(2, 5)) == 2)
+    assert(buf:utf8_len(0, 0) == 0 and buf:utf8_len(1, 4) == 1)
+    assert(buf:utf8_valid(0, 6) == nil)
+
+    -- Code points.
+    local s = 'h\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80!'
+    local expected = {}
+
+    for position, codepoint in utf8.codes(s) do
+        expected[#expected + 1] = {position - 1, codepoint}
+    end
+
+    local i = 0
+
+    for position, codepoint in assert(buffer.new(s)):codepoints() do
+        i = i + 1
+        assert(position == expected[i][1] and codepoint == expected[i][2])
+    end
+
+    assert(i == #expected)
+
+    local iterator = assert(buffer.new('ok\xed\xa0\x80')):codepoints()
+    assert(iterator() == 0 and iterator() == 1)
+    assert(not pcall(iterator))
+end
+
+-------------------------------------------------------------------------------
+-- Hex and base64
+
+do
+    local digits = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/'
+
+    local function base64(s)
+        local result = {}
+
+        for i = 1, #s, 3 do
+            local a, b, c = s:byte(i, i + 2)
+            local group = a << 16 | (b or 0) << 8 | (c or 0)
+
+            for j = 18, 0, -6 do
+                local k = (group >> j & 63) + 1
+                result[#result + 1] = digits:sub(k, k)
+            end
+
+            if not c then
+                result[#result] = '='
+
+                if not b then
+                    result[#result - 1] = '='
+                end
+            end
+        end
+
+        return table.concat(result)
+    end
+
+    local function unhex(s)
+        return (s:gsub('%x%x', function(x) return string.char(tonumber(x, 16)) end))
+    end
+
+    local data = {}
+
+    for i = 0, 299 do
+        data[#data + 1] = string.char((i * 167 + 13) & 255)
+    end
+
+    data = table.concat(data)
+
+    -- Round trips, with and without padding, for lengths that exercise all the tails.
+    for length = 0, 100 do
+        local s = data:sub(1, length)
+        local buf = assert(buffer.new(s))
+        local hex = buf:hex()
+        assert(#hex == 2 * length and hex == hex:lower() and unhex(hex) == s)
+
+        local encoded = buf:base64()
+        assert(encoded == base64(s), length)
+        assert(assert(buffer.from_base64(encoded)):read(length) == s)
+        assert(assert(buffer.from_base64((encoded:gsub('=', '')))):read(length) == s)
+    end
+
+    local buf = assert(buffer.new(data))
+    assert(buf:hex(100, 120) == buf:sub(100, 20):hex())
+    assert(unhex(buf:hex(1, 299)) == data:sub(2, 299))
+    assert(buf:base64(1, 299) == base64(data:sub(2, 299)))
+
+    -- Empty input.
+    assert(buffer.new(''):hex() == '' and buffer.new(''):base64() == '')
+    assert(assert(buffer.from_base64('')):size() == 0)
+
+    -- Padding.
+    assert(assert(buffer.from_base64('aGVsbG8=')):read(5) == 'hello')
+    assert(assert(buffer.from_base64('aGVsbA==')):read(4) == 'hell')
+    assert(assert(buffer.from_base64('aGVsbG8')):read(5) == 'hello')
+    assert(assert(buffer.from_base64('aGVsbA')):read(4) == 'hell')
+
+    for s, position in pairs{['aGVsb'] = 4, ['aGVsbG8=='] = 7, ['a==='] = 1, ['===='] = 0, ['='] = 0, ['aGVs=A=='] = 4} do
+        local value, err = buffer.from_base64(s)
+        assert(value == nil and err == 'invalid base64 digit at position: ' .. position, s)
+    end
+
+    -- An invalid digit at each position, in blocks decoded 16 digits at a time and in the tail.
+    local encoded = base64(data:sub(1, 60))
+
+    for position = 0, #encoded - 1 do
+        for _, digit in ipairs{'*', '-', '_', ' ', '=', '@', '[', '`', '{', '\0', '\t', '\x1f', '\x7f', '\x80', '\xff'} do
+            -- An = at the end is padding.
+            if digit ~= '=' or position ~= #encoded - 1 then
+                local s = encoded:sub(1, position) .. digit .. encoded:sub(position + 2)
+                local value, err = buffer.from_base64(s)
+                assert(value == nil and err == 'invalid base64 digit at position: ' .. position, position)
+            end
+        end
+    end
+end
@@ -42,8 +42,25 @@ Based on code by UChicago Argonne, LLC.
 // *****************************************************************************
 */
 
+#if defined(__unix__) || defined(__APPLE__)
+#define CRC64_MMAP
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include <stdlib.h>
 #include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef CRC64_MMAP
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#endif
 
 static uint64_t const table[256] = {
     UINT64_C(0x0000000000000000), UINT64_C(0xb32e4cbe03a75f6f),
@@ -176,22 +193,2394 @@ static uint64_t const table[256] = {
     UINT64_C(0x5383edcd67c06036), UINT64_C(0xe0ada17364673f59)
 };
 
-uint64_t crc64(void const* input, size_t nbytes) {
-    uint8_t const* data = (uint8_t const*) input;
-    uint64_t cs = UINT64_C(0xffffffffffffffff);
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRC64_CLMUL
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
 
+/* slice[k][i] is the CRC of byte i followed by k zero bytes, slice[0] is table */
+static uint64_t const slice[16][256] = {
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xb32e4cbe03a75f6f),
+        UINT64_C(0xf4843657a840a05b), UINT64_C(0x47aa7ae9abe7ff34),
+        UINT64_C(0x7bd0c384ff8f5e33), UINT64_C(0xc8fe8f3afc28015c),
+        UINT64_C(0x8f54f5d357cffe68), UINT64_C(0x3c7ab96d5468a107),
+        UINT64_C(0xf7a18709ff1ebc66), UINT64_C(0x448fcbb7fcb9e309),
+        UINT64_C(0x0325b15e575e1c3d), UINT64_C(0xb00bfde054f94352),
+        UINT64_C(0x8c71448d0091e255), UINT64_C(0x3f5f08330336bd3a),
+        UINT64_C(0x78f572daa8d1420e), UINT64_C(0xcbdb3e64ab761d61),
+        UINT64_C(0x7d9ba13851336649), UINT64_C(0xceb5ed8652943926),
+        UINT64_C(0x891f976ff973c612), UINT64_C(0x3a31dbd1fad4997d),
+        UINT64_C(0x064b62bcaebc387a), UINT64_C(0xb5652e02ad1b6715),
+        UINT64_C(0xf2cf54eb06fc9821), UINT64_C(0x41e11855055bc74e),
+        UINT64_C(0x8a3a2631ae2dda2f), UINT64_C(0x39146a8fad8a8540),
+        UINT64_C(0x7ebe1066066d7a74), UINT64_C(0xcd905cd805ca251b),
+        UINT64_C(0xf1eae5b551a2841c), UINT64_C(0x42c4a90b5205db73),
+        UINT64_C(0x056ed3e2f9e22447), UINT64_C(0xb6409f5cfa457b28),
+        UINT64_C(0xfb374270a266cc92), UINT64_C(0x48190ecea1c193fd),
+        UINT64_C(0x0fb374270a266cc9), UINT64_C(0xbc9d3899098133a6),
+        UINT64_C(0x80e781f45de992a1), UINT64_C(0x33c9cd4a5e4ecdce),
+        UINT64_C(0x7463b7a3f5a932fa), UINT64_C(0xc74dfb1df60e6d95),
+        UINT64_C(0x0c96c5795d7870f4), UINT64_C(0xbfb889c75edf2f9b),
+        UINT64_C(0xf812f32ef538d0af), UINT64_C(0x4b3cbf90f69f8fc0),
+        UINT64_C(0x774606fda2f72ec7), UINT64_C(0xc4684a43a15071a8),
+        UINT64_C(0x83c230aa0ab78e9c), UINT64_C(0x30ec7c140910d1f3),
+        UINT64_C(0x86ace348f355aadb), UINT64_C(0x3582aff6f0f2f5b4),
+        UINT64_C(0x7228d51f5b150a80), UINT64_C(0xc10699a158b255ef),
+        UINT64_C(0xfd7c20cc0cdaf4e8), UINT64_C(0x4e526c720f7dab87),
+        UINT64_C(0x09f8169ba49a54b3), UINT64_C(0xbad65a25a73d0bdc),
+        UINT64_C(0x710d64410c4b16bd), UINT64_C(0xc22328ff0fec49d2),
+        UINT64_C(0x85895216a40bb6e6), UINT64_C(0x36a71ea8a7ace989),
+        UINT64_C(0x0adda7c5f3c4488e), UINT64_C(0xb9f3eb7bf06317e1),
+        UINT64_C(0xfe5991925b84e8d5), UINT64_C(0x4d77dd2c5823b7ba),
+        UINT64_C(0x64b62bcaebc387a1), UINT64_C(0xd7986774e864d8ce),
+        UINT64_C(0x90321d9d438327fa), UINT64_C(0x231c512340247895),
+        UINT64_C(0x1f66e84e144cd992), UINT64_C(0xac48a4f017eb86fd),
+        UINT64_C(0xebe2de19bc0c79c9), UINT64_C(0x58cc92a7bfab26a6),
+        UINT64_C(0x9317acc314dd3bc7), UINT64_C(0x2039e07d177a64a8),
+        UINT64_C(0x67939a94bc9d9b9c), UINT64_C(0xd4bdd62abf3ac4f3),
+        UINT64_C(0xe8c76f47eb5265f4), UINT64_C(0x5be923f9e8f53a9b),
+        UINT64_C(0x1c4359104312c5af), UINT64_C(0xaf6d15ae40b59ac0),
+        UINT64_C(0x192d8af2baf0e1e8), UINT64_C(0xaa03c64cb957be87),
+        UINT64_C(0xeda9bca512b041b3), UINT64_C(0x5e87f01b11171edc),
+        UINT64_C(0x62fd4976457fbfdb), UINT64_C(0xd1d305c846d8e0b4),
+        UINT64_C(0x96797f21ed3f1f80), UINT64_C(0x2557339fee9840ef),
+        UINT64_C(0xee8c0dfb45ee5d8e), UINT64_C(0x5da24145464902e1),
+        UINT64_C(0x1a083bacedaefdd5), UINT64_C(0xa9267712ee09a2ba),
+        UINT64_C(0x955cce7fba6103bd), UINT64_C(0x267282c1b9c65cd2),
+        UINT64_C(0x61d8f8281221a3e6), UINT64_C(0xd2f6b4961186fc89),
+        UINT64_C(0x9f8169ba49a54b33), UINT64_C(0x2caf25044a02145c),
+        UINT64_C(0x6b055fede1e5eb68), UINT64_C(0xd82b1353e242b407),
+        UINT64_C(0xe451aa3eb62a1500), UINT64_C(0x577fe680b58d4a6f),
+        UINT64_C(0x10d59c691e6ab55b), UINT64_C(0xa3fbd0d71dcdea34),
+        UINT64_C(0x6820eeb3b6bbf755), UINT64_C(0xdb0ea20db51ca83a),
+        UINT64_C(0x9ca4d8e41efb570e), UINT64_C(0x2f8a945a1d5c0861),
+        UINT64_C(0x13f02d374934a966), UINT64_C(0xa0de61894a93f609),
+        UINT64_C(0xe7741b60e174093d), UINT64_C(0x545a57dee2d35652),
+        UINT64_C(0xe21ac88218962d7a), UINT64_C(0x5134843c1b317215),
+        UINT64_C(0x169efed5b0d68d21), UINT64_C(0xa5b0b26bb371d24e),
+        UINT64_C(0x99ca0b06e7197349), UINT64_C(0x2ae447b8e4be2c26),
+        UINT64_C(0x6d4e3d514f59d312), UINT64_C(0xde6071ef4cfe8c7d),
+        UINT64_C(0x15bb4f8be788911c), UINT64_C(0xa6950335e42fce73),
+        UINT64_C(0xe13f79dc4fc83147), UINT64_C(0x521135624c6f6e28),
+        UINT64_C(0x6e6b8c0f1807cf2f), UINT64_C(0xdd45c0b11ba09040),
+        UINT64_C(0x9aefba58b0476f74), UINT64_C(0x29c1f6e6b3e0301b),
+        UINT64_C(0xc96c5795d7870f42), UINT64_C(0x7a421b2bd420502d),
+        UINT64_C(0x3de861c27fc7af19), UINT64_C(0x8ec62d7c7c60f076),
+        UINT64_C(0xb2bc941128085171), UINT64_C(0x0192d8af2baf0e1e),
+        UINT64_C(0x4638a2468048f12a), UINT64_C(0xf516eef883efae45),
+        UINT64_C(0x3ecdd09c2899b324), UINT64_C(0x8de39c222b3eec4b),
+        UINT64_C(0xca49e6cb80d9137f), UINT64_C(0x7967aa75837e4c10),
+        UINT64_C(0x451d1318d716ed17), UINT64_C(0xf6335fa6d4b1b278),
+        UINT64_C(0xb199254f7f564d4c), UINT64_C(0x02b769f17cf11223),
+        UINT64_C(0xb4f7f6ad86b4690b), UINT64_C(0x07d9ba1385133664),
+        UINT64_C(0x4073c0fa2ef4c950), UINT64_C(0xf35d8c442d53963f),
+        UINT64_C(0xcf273529793b3738), UINT64_C(0x7c0979977a9c6857),
+        UINT64_C(0x3ba3037ed17b9763), UINT64_C(0x888d4fc0d2dcc80c),
+        UINT64_C(0x435671a479aad56d), UINT64_C(0xf0783d1a7a0d8a02),
+        UINT64_C(0xb7d247f3d1ea7536), UINT64_C(0x04fc0b4dd24d2a59),
+        UINT64_C(0x3886b22086258b5e), UINT64_C(0x8ba8fe9e8582d431),
+        UINT64_C(0xcc0284772e652b05), UINT64_C(0x7f2cc8c92dc2746a),
+        UINT64_C(0x325b15e575e1c3d0), UINT64_C(0x8175595b76469cbf),
+        UINT64_C(0xc6df23b2dda1638b), UINT64_C(0x75f16f0cde063ce4),
+        UINT64_C(0x498bd6618a6e9de3), UINT64_C(0xfaa59adf89c9c28c),
+        UINT64_C(0xbd0fe036222e3db8), UINT64_C(0x0e21ac88218962d7),
+        UINT64_C(0xc5fa92ec8aff7fb6), UINT64_C(0x76d4de52895820d9),
+        UINT64_C(0x317ea4bb22bfdfed), UINT64_C(0x8250e80521188082),
+        UINT64_C(0xbe2a516875702185), UINT64_C(0x0d041dd676d77eea),
+        UINT64_C(0x4aae673fdd3081de), UINT64_C(0xf9802b81de97deb1),
+        UINT64_C(0x4fc0b4dd24d2a599), UINT64_C(0xfceef8632775faf6),
+        UINT64_C(0xbb44828a8c9205c2), UINT64_C(0x086ace348f355aad),
+        UINT64_C(0x34107759db5dfbaa), UINT64_C(0x873e3be7d8faa4c5),
+        UINT64_C(0xc094410e731d5bf1), UINT64_C(0x73ba0db070ba049e),
+        UINT64_C(0xb86133d4dbcc19ff), UINT64_C(0x0b4f7f6ad86b4690),
+        UINT64_C(0x4ce50583738cb9a4), UINT64_C(0xffcb493d702be6cb),
+        UINT64_C(0xc3b1f050244347cc), UINT64_C(0x709fbcee27e418a3),
+        UINT64_C(0x3735c6078c03e797), UINT64_C(0x841b8ab98fa4b8f8),
+        UINT64_C(0xadda7c5f3c4488e3), UINT64_C(0x1ef430e13fe3d78c),
+        UINT64_C(0x595e4a08940428b8), UINT64_C(0xea7006b697a377d7),
+        UINT64_C(0xd60abfdbc3cbd6d0), UINT64_C(0x6524f365c06c89bf),
+        UINT64_C(0x228e898c6b8b768b), UINT64_C(0x91a0c532682c29e4),
+        UINT64_C(0x5a7bfb56c35a3485), UINT64_C(0xe955b7e8c0fd6bea),
+        UINT64_C(0xaeffcd016b1a94de), UINT64_C(0x1dd181bf68bdcbb1),
+        UINT64_C(0x21ab38d23cd56ab6), UINT64_C(0x9285746c3f7235d9),
+        UINT64_C(0xd52f0e859495caed), UINT64_C(0x6601423b97329582),
+        UINT64_C(0xd041dd676d77eeaa), UINT64_C(0x636f91d96ed0b1c5),
+        UINT64_C(0x24c5eb30c5374ef1), UINT64_C(0x97eba78ec690119e),
+        UINT64_C(0xab911ee392f8b099), UINT64_C(0x18bf525d915feff6),
+        UINT64_C(0x5f1528b43ab810c2), UINT64_C(0xec3b640a391f4fad),
+        UINT64_C(0x27e05a6e926952cc), UINT64_C(0x94ce16d091ce0da3),
+        UINT64_C(0xd3646c393a29f297), UINT64_C(0x604a2087398eadf8),
+        UINT64_C(0x5c3099ea6de60cff), UINT64_C(0xef1ed5546e415390),
+        UINT64_C(0xa8b4afbdc5a6aca4), UINT64_C(0x1b9ae303c601f3cb),
+        UINT64_C(0x56ed3e2f9e224471), UINT64_C(0xe5c372919d851b1e),
+        UINT64_C(0xa26908783662e42a), UINT64_C(0x114744c635c5bb45),
+        UINT64_C(0x2d3dfdab61ad1a42), UINT64_C(0x9e13b115620a452d),
+        UINT64_C(0xd9b9cbfcc9edba19), UINT64_C(0x6a978742ca4ae576),
+        UINT64_C(0xa14cb926613cf817), UINT64_C(0x1262f598629ba778),
+        UINT64_C(0x55c88f71c97c584c), UINT64_C(0xe6e6c3cfcadb0723),
+        UINT64_C(0xda9c7aa29eb3a624), UINT64_C(0x69b2361c9d14f94b),
+        UINT64_C(0x2e184cf536f3067f), UINT64_C(0x9d36004b35545910),
+        UINT64_C(0x2b769f17cf112238), UINT64_C(0x9858d3a9ccb67d57),
+        UINT64_C(0xdff2a94067518263), UINT64_C(0x6cdce5fe64f6dd0c),
+        UINT64_C(0x50a65c93309e7c0b), UINT64_C(0xe388102d33392364),
+        UINT64_C(0xa4226ac498dedc50), UINT64_C(0x170c267a9b79833f),
+        UINT64_C(0xdcd7181e300f9e5e), UINT64_C(0x6ff954a033a8c131),
+        UINT64_C(0x28532e49984f3e05), UINT64_C(0x9b7d62f79be8616a),
+        UINT64_C(0xa707db9acf80c06d), UINT64_C(0x14299724cc279f02),
+        UINT64_C(0x5383edcd67c06036), UINT64_C(0xe0ada17364673f59)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x54e979925cd0f10d),
+        UINT64_C(0xa9d2f324b9a1e21a), UINT64_C(0xfd3b8ab6e5711317),
+        UINT64_C(0xc17d4962dc4ddab1), UINT64_C(0x959430f0809d2bbc),
+        UINT64_C(0x68afba4665ec38ab), UINT64_C(0x3c46c3d4393cc9a6),
+        UINT64_C(0x10223dee1795abe7), UINT64_C(0x44cb447c4b455aea),
+        UINT64_C(0xb9f0cecaae3449fd), UINT64_C(0xed19b758f2e4b8f0),
+        UINT64_C(0xd15f748ccbd87156), UINT64_C(0x85b60d1e9708805b),
+        UINT64_C(0x788d87a87279934c), UINT64_C(0x2c64fe3a2ea96241),
+        UINT64_C(0x20447bdc2f2b57ce), UINT64_C(0x74ad024e73fba6c3),
+        UINT64_C(0x899688f8968ab5d4), UINT64_C(0xdd7ff16aca5a44d9),
+        UINT64_C(0xe13932bef3668d7f), UINT64_C(0xb5d04b2cafb67c72),
+        UINT64_C(0x48ebc19a4ac76f65), UINT64_C(0x1c02b80816179e68),
+        UINT64_C(0x3066463238befc29), UINT64_C(0x648f3fa0646e0d24),
+        UINT64_C(0x99b4b516811f1e33), UINT64_C(0xcd5dcc84ddcfef3e),
+        UINT64_C(0xf11b0f50e4f32698), UINT64_C(0xa5f276c2b823d795),
+        UINT64_C(0x58c9fc745d52c482), UINT64_C(0x0c2085e60182358f),
+        UINT64_C(0x4088f7b85e56af9c), UINT64_C(0x14618e2a02865e91),
+        UINT64_C(0xe95a049ce7f74d86), UINT64_C(0xbdb37d0ebb27bc8b),
+        UINT64_C(0x81f5beda821b752d), UINT64_C(0xd51cc748decb8420),
+        UINT64_C(0x28274dfe3bba9737), UINT64_C(0x7cce346c676a663a),
+        UINT64_C(0x50aaca5649c3047b), UINT64_C(0x0443b3c41513f576),
+        UINT64_C(0xf9783972f062e661), UINT64_C(0xad9140e0acb2176c),
+        UINT64_C(0x91d78334958edeca), UINT64_C(0xc53efaa6c95e2fc7),
+        UINT64_C(0x380570102c2f3cd0), UINT64_C(0x6cec098270ffcddd),
+        UINT64_C(0x60cc8c64717df852), UINT64_C(0x3425f5f62dad095f),
+        UINT64_C(0xc91e7f40c8dc1a48), UINT64_C(0x9df706d2940ceb45),
+        UINT64_C(0xa1b1c506ad3022e3), UINT64_C(0xf558bc94f1e0d3ee),
+        UINT64_C(0x086336221491c0f9), UINT64_C(0x5c8a4fb0484131f4),
+        UINT64_C(0x70eeb18a66e853b5), UINT64_C(0x2407c8183a38a2b8),
+        UINT64_C(0xd93c42aedf49b1af), UINT64_C(0x8dd53b3c839940a2),
+        UINT64_C(0xb193f8e8baa58904), UINT64_C(0xe57a817ae6757809),
+        UINT64_C(0x18410bcc03046b1e), UINT64_C(0x4ca8725e5fd49a13),
+        UINT64_C(0x8111ef70bcad5f38), UINT64_C(0xd5f896e2e07dae35),
+        UINT64_C(0x28c31c54050cbd22), UINT64_C(0x7c2a65c659dc4c2f),
+        UINT64_C(0x406ca61260e08589), UINT64_C(0x1485df803c307484),
+        UINT64_C(0xe9be5536d9416793), UINT64_C(0xbd572ca48591969e),
+        UINT64_C(0x9133d29eab38f4df), UINT64_C(0xc5daab0cf7e805d2),
+        UINT64_C(0x38e121ba129916c5), UINT64_C(0x6c0858284e49e7c8),
+        UINT64_C(0x504e9bfc77752e6e), UINT64_C(0x04a7e26e2ba5df63),
+        UINT64_C(0xf99c68d8ced4cc74), UINT64_C(0xad75114a92043d79),
+        UINT64_C(0xa15594ac938608f6), UINT64_C(0xf5bced3ecf56f9fb),
+        UINT64_C(0x088767882a27eaec), UINT64_C(0x5c6e1e1a76f71be1),
+        UINT64_C(0x6028ddce4fcbd247), UINT64_C(0x34c1a45c131b234a),
+        UINT64_C(0xc9fa2eeaf66a305d), UINT64_C(0x9d135778aabac150),
+        UINT64_C(0xb177a9428413a311), UINT64_C(0xe59ed0d0d8c3521c),
+        UINT64_C(0x18a55a663db2410b), UINT64_C(0x4c4c23f46162b006),
+        UINT64_C(0x700ae020585e79a0), UINT64_C(0x24e399b2048e88ad),
+        UINT64_C(0xd9d81304e1ff9bba), UINT64_C(0x8d316a96bd2f6ab7),
+        UINT64_C(0xc19918c8e2fbf0a4), UINT64_C(0x9570615abe2b01a9),
+        UINT64_C(0x684bebec5b5a12be), UINT64_C(0x3ca2927e078ae3b3),
+        UINT64_C(0x00e451aa3eb62a15), UINT64_C(0x540d28386266db18),
+        UINT64_C(0xa936a28e8717c80f), UINT64_C(0xfddfdb1cdbc73902),
+        UINT64_C(0xd1bb2526f56e5b43), UINT64_C(0x85525cb4a9beaa4e),
+        UINT64_C(0x7869d6024ccfb959), UINT64_C(0x2c80af90101f4854),
+        UINT64_C(0x10c66c44292381f2), UINT64_C(0x442f15d675f370ff),
+        UINT64_C(0xb9149f60908263e8), UINT64_C(0xedfde6f2cc5292e5),
+        UINT64_C(0xe1dd6314cdd0a76a), UINT64_C(0xb5341a8691005667),
+        UINT64_C(0x480f903074714570), UINT64_C(0x1ce6e9a228a1b47d),
+        UINT64_C(0x20a02a76119d7ddb), UINT64_C(0x744953e44d4d8cd6),
+        UINT64_C(0x8972d952a83c9fc1), UINT64_C(0xdd9ba0c0f4ec6ecc),
+        UINT64_C(0xf1ff5efada450c8d), UINT64_C(0xa51627688695fd80),
+        UINT64_C(0x582dadde63e4ee97), UINT64_C(0x0cc4d44c3f341f9a),
+        UINT64_C(0x308217980608d63c), UINT64_C(0x646b6e0a5ad82731),
+        UINT64_C(0x9950e4bcbfa93426), UINT64_C(0xcdb99d2ee379c52b),
+        UINT64_C(0x90fb71cad654a0f5), UINT64_C(0xc41208588a8451f8),
+        UINT64_C(0x392982ee6ff542ef), UINT64_C(0x6dc0fb7c3325b3e2),
+        UINT64_C(0x518638a80a197a44), UINT64_C(0x056f413a56c98b49),
+        UINT64_C(0xf854cb8cb3b8985e), UINT64_C(0xacbdb21eef686953),
+        UINT64_C(0x80d94c24c1c10b12), UINT64_C(0xd43035b69d11fa1f),
+        UINT64_C(0x290bbf007860e908), UINT64_C(0x7de2c69224b01805),
+        UINT64_C(0x41a405461d8cd1a3), UINT64_C(0x154d7cd4415c20ae),
+        UINT64_C(0xe876f662a42d33b9), UINT64_C(0xbc9f8ff0f8fdc2b4),
+        UINT64_C(0xb0bf0a16f97ff73b), UINT64_C(0xe4567384a5af0636),
+        UINT64_C(0x196df93240de1521), UINT64_C(0x4d8480a01c0ee42c),
+        UINT64_C(0x71c2437425322d8a), UINT64_C(0x252b3ae679e2dc87),
+        UINT64_C(0xd810b0509c93cf90), UINT64_C(0x8cf9c9c2c0433e9d),
+        UINT64_C(0xa09d37f8eeea5cdc), UINT64_C(0xf4744e6ab23aadd1),
+        UINT64_C(0x094fc4dc574bbec6), UINT64_C(0x5da6bd4e0b9b4fcb),
+        UINT64_C(0x61e07e9a32a7866d), UINT64_C(0x350907086e777760),
+        UINT64_C(0xc8328dbe8b066477), UINT64_C(0x9cdbf42cd7d6957a),
+        UINT64_C(0xd073867288020f69), UINT64_C(0x849affe0d4d2fe64),
+        UINT64_C(0x79a1755631a3ed73), UINT64_C(0x2d480cc46d731c7e),
+        UINT64_C(0x110ecf10544fd5d8), UINT64_C(0x45e7b682089f24d5),
+        UINT64_C(0xb8dc3c34edee37c2), UINT64_C(0xec3545a6b13ec6cf),
+        UINT64_C(0xc051bb9c9f97a48e), UINT64_C(0x94b8c20ec3475583),
+        UINT64_C(0x698348b826364694), UINT64_C(0x3d6a312a7ae6b799),
+        UINT64_C(0x012cf2fe43da7e3f), UINT64_C(0x55c58b6c1f0a8f32),
+        UINT64_C(0xa8fe01dafa7b9c25), UINT64_C(0xfc177848a6ab6d28),
+        UINT64_C(0xf037fdaea72958a7), UINT64_C(0xa4de843cfbf9a9aa),
+        UINT64_C(0x59e50e8a1e88babd), UINT64_C(0x0d0c771842584bb0),
+        UINT64_C(0x314ab4cc7b648216), UINT64_C(0x65a3cd5e27b4731b),
+        UINT64_C(0x989847e8c2c5600c), UINT64_C(0xcc713e7a9e159101),
+        UINT64_C(0xe015c040b0bcf340), UINT64_C(0xb4fcb9d2ec6c024d),
+        UINT64_C(0x49c73364091d115a), UINT64_C(0x1d2e4af655cde057),
+        UINT64_C(0x216889226cf129f1), UINT64_C(0x7581f0b03021d8fc),
+        UINT64_C(0x88ba7a06d550cbeb), UINT64_C(0xdc53039489803ae6),
+        UINT64_C(0x11ea9eba6af9ffcd), UINT64_C(0x4503e72836290ec0),
+        UINT64_C(0xb8386d9ed3581dd7), UINT64_C(0xecd1140c8f88ecda),
+        UINT64_C(0xd097d7d8b6b4257c), UINT64_C(0x847eae4aea64d471),
+        UINT64_C(0x794524fc0f15c766), UINT64_C(0x2dac5d6e53c5366b),
+        UINT64_C(0x01c8a3547d6c542a), UINT64_C(0x5521dac621bca527),
+        UINT64_C(0xa81a5070c4cdb630), UINT64_C(0xfcf329e2981d473d),
+        UINT64_C(0xc0b5ea36a1218e9b), UINT64_C(0x945c93a4fdf17f96),
+        UINT64_C(0x6967191218806c81), UINT64_C(0x3d8e608044509d8c),
+        UINT64_C(0x31aee56645d2a803), UINT64_C(0x65479cf41902590e),
+        UINT64_C(0x987c1642fc734a19), UINT64_C(0xcc956fd0a0a3bb14),
+        UINT64_C(0xf0d3ac04999f72b2), UINT64_C(0xa43ad596c54f83bf),
+        UINT64_C(0x59015f20203e90a8), UINT64_C(0x0de826b27cee61a5),
+        UINT64_C(0x218cd888524703e4), UINT64_C(0x7565a11a0e97f2e9),
+        UINT64_C(0x885e2bacebe6e1fe), UINT64_C(0xdcb7523eb73610f3),
+        UINT64_C(0xe0f191ea8e0ad955), UINT64_C(0xb418e878d2da2858),
+        UINT64_C(0x492362ce37ab3b4f), UINT64_C(0x1dca1b5c6b7bca42),
+        UINT64_C(0x5162690234af5051), UINT64_C(0x058b1090687fa15c),
+        UINT64_C(0xf8b09a268d0eb24b), UINT64_C(0xac59e3b4d1de4346),
+        UINT64_C(0x901f2060e8e28ae0), UINT64_C(0xc4f659f2b4327bed),
+        UINT64_C(0x39cdd344514368fa), UINT64_C(0x6d24aad60d9399f7),
+        UINT64_C(0x414054ec233afbb6), UINT64_C(0x15a92d7e7fea0abb),
+        UINT64_C(0xe892a7c89a9b19ac), UINT64_C(0xbc7bde5ac64be8a1),
+        UINT64_C(0x803d1d8eff772107), UINT64_C(0xd4d4641ca3a7d00a),
+        UINT64_C(0x29efeeaa46d6c31d), UINT64_C(0x7d0697381a063210),
+        UINT64_C(0x712612de1b84079f), UINT64_C(0x25cf6b4c4754f692),
+        UINT64_C(0xd8f4e1faa225e585), UINT64_C(0x8c1d9868fef51488),
+        UINT64_C(0xb05b5bbcc7c9dd2e), UINT64_C(0xe4b2222e9b192c23),
+        UINT64_C(0x1989a8987e683f34), UINT64_C(0x4d60d10a22b8ce39),
+        UINT64_C(0x61042f300c11ac78), UINT64_C(0x35ed56a250c15d75),
+        UINT64_C(0xc8d6dc14b5b04e62), UINT64_C(0x9c3fa586e960bf6f),
+        UINT64_C(0xa0796652d05c76c9), UINT64_C(0xf4901fc08c8c87c4),
+        UINT64_C(0x09ab957669fd94d3), UINT64_C(0x5d42ece4352d65de)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x3f0be14a916a6dcb),
+        UINT64_C(0x7e17c29522d4db96), UINT64_C(0x411c23dfb3beb65d),
+        UINT64_C(0xfc2f852a45a9b72c), UINT64_C(0xc3246460d4c3dae7),
+        UINT64_C(0x823847bf677d6cba), UINT64_C(0xbd33a6f5f6170171),
+        UINT64_C(0x6a87a57f245d70dd), UINT64_C(0x558c4435b5371d16),
+        UINT64_C(0x149067ea0689ab4b), UINT64_C(0x2b9b86a097e3c680),
+        UINT64_C(0x96a8205561f4c7f1), UINT64_C(0xa9a3c11ff09eaa3a),
+        UINT64_C(0xe8bfe2c043201c67), UINT64_C(0xd7b4038ad24a71ac),
+        UINT64_C(0xd50f4afe48bae1ba), UINT64_C(0xea04abb4d9d08c71),
+        UINT64_C(0xab18886b6a6e3a2c), UINT64_C(0x94136921fb0457e7),
+        UINT64_C(0x2920cfd40d135696), UINT64_C(0x162b2e9e9c793b5d),
+        UINT64_C(0x57370d412fc78d00), UINT64_C(0x683cec0bbeade0cb),
+        UINT64_C(0xbf88ef816ce79167), UINT64_C(0x80830ecbfd8dfcac),
+        UINT64_C(0xc19f2d144e334af1), UINT64_C(0xfe94cc5edf59273a),
+        UINT64_C(0x43a76aab294e264b), UINT64_C(0x7cac8be1b8244b80),
+        UINT64_C(0x3db0a83e0b9afddd), UINT64_C(0x02bb49749af09016),
+        UINT64_C(0x38c63ad73e7bddf1), UINT64_C(0x07cddb9daf11b03a),
+        UINT64_C(0x46d1f8421caf0667), UINT64_C(0x79da19088dc56bac),
+        UINT64_C(0xc4e9bffd7bd26add), UINT64_C(0xfbe25eb7eab80716),
+        UINT64_C(0xbafe7d685906b14b), UINT64_C(0x85f59c22c86cdc80),
+        UINT64_C(0x52419fa81a26ad2c), UINT64_C(0x6d4a7ee28b4cc0e7),
+        UINT64_C(0x2c565d3d38f276ba), UINT64_C(0x135dbc77a9981b71),
+        UINT64_C(0xae6e1a825f8f1a00), UINT64_C(0x9165fbc8cee577cb),
+        UINT64_C(0xd079d8177d5bc196), UINT64_C(0xef72395dec31ac5d),
+        UINT64_C(0xedc9702976c13c4b), UINT64_C(0xd2c29163e7ab5180),
+        UINT64_C(0x93deb2bc5415e7dd), UINT64_C(0xacd553f6c57f8a16),
+        UINT64_C(0x11e6f50333688b67), UINT64_C(0x2eed1449a202e6ac),
+        UINT64_C(0x6ff1379611bc50f1), UINT64_C(0x50fad6dc80d63d3a),
+        UINT64_C(0x874ed556529c4c96), UINT64_C(0xb845341cc3f6215d),
+        UINT64_C(0xf95917c370489700), UINT64_C(0xc652f689e122facb),
+        UINT64_C(0x7b61507c1735fbba), UINT64_C(0x446ab136865f9671),
+        UINT64_C(0x057692e935e1202c), UINT64_C(0x3a7d73a3a48b4de7),
+        UINT64_C(0x718c75ae7cf7bbe2), UINT64_C(0x4e8794e4ed9dd629),
+        UINT64_C(0x0f9bb73b5e236074), UINT64_C(0x30905671cf490dbf),
+        UINT64_C(0x8da3f084395e0cce), UINT64_C(0xb2a811cea8346105),
+        UINT64_C(0xf3b432111b8ad758), UINT64_C(0xccbfd35b8ae0ba93),
+        UINT64_C(0x1b0bd0d158aacb3f), UINT64_C(0x2400319bc9c0a6f4),
+        UINT64_C(0x651c12447a7e10a9), UINT64_C(0x5a17f30eeb147d62),
+        UINT64_C(0xe72455fb1d037c13), UINT64_C(0xd82fb4b18c6911d8),
+        UINT64_C(0x9933976e3fd7a785), UINT64_C(0xa6387624aebdca4e),
+        UINT64_C(0xa4833f50344d5a58), UINT64_C(0x9b88de1aa5273793),
+        UINT64_C(0xda94fdc5169981ce), UINT64_C(0xe59f1c8f87f3ec05),
+        UINT64_C(0x58acba7a71e4ed74), UINT64_C(0x67a75b30e08e80bf),
+        UINT64_C(0x26bb78ef533036e2), UINT64_C(0x19b099a5c25a5b29),
+        UINT64_C(0xce049a2f10102a85), UINT64_C(0xf10f7b65817a474e),
+        UINT64_C(0xb01358ba32c4f113), UINT64_C(0x8f18b9f0a3ae9cd8),
+        UINT64_C(0x322b1f0555b99da9), UINT64_C(0x0d20fe4fc4d3f062),
+        UINT64_C(0x4c3cdd90776d463f), UINT64_C(0x73373cdae6072bf4),
+        UINT64_C(0x494a4f79428c6613), UINT64_C(0x7641ae33d3e60bd8),
+        UINT64_C(0x375d8dec6058bd85), UINT64_C(0x08566ca6f132d04e),
+        UINT64_C(0xb565ca530725d13f), UINT64_C(0x8a6e2b19964fbcf4),
+        UINT64_C(0xcb7208c625f10aa9), UINT64_C(0xf479e98cb49b6762),
+        UINT64_C(0x23cdea0666d116ce), UINT64_C(0x1cc60b4cf7bb7b05),
+        UINT64_C(0x5dda28934405cd58), UINT64_C(0x62d1c9d9d56fa093),
+        UINT64_C(0xdfe26f2c2378a1e2), UINT64_C(0xe0e98e66b212cc29),
+        UINT64_C(0xa1f5adb901ac7a74), UINT64_C(0x9efe4cf390c617bf),
+        UINT64_C(0x9c4505870a3687a9), UINT64_C(0xa34ee4cd9b5cea62),
+        UINT64_C(0xe252c71228e25c3f), UINT64_C(0xdd592658b98831f4),
+        UINT64_C(0x606a80ad4f9f3085), UINT64_C(0x5f6161e7def55d4e),
+        UINT64_C(0x1e7d42386d4beb13), UINT64_C(0x2176a372fc2186d8),
+        UINT64_C(0xf6c2a0f82e6bf774), UINT64_C(0xc9c941b2bf019abf),
+        UINT64_C(0x88d5626d0cbf2ce2), UINT64_C(0xb7de83279dd54129),
+        UINT64_C(0x0aed25d26bc24058), UINT64_C(0x35e6c498faa82d93),
+        UINT64_C(0x74fae74749169bce), UINT64_C(0x4bf1060dd87cf605),
+        UINT64_C(0xe318eb5cf9ef77c4), UINT64_C(0xdc130a1668851a0f),
+        UINT64_C(0x9d0f29c9db3bac52), UINT64_C(0xa204c8834a51c199),
+        UINT64_C(0x1f376e76bc46c0e8), UINT64_C(0x203c8f3c2d2cad23),
+        UINT64_C(0x6120ace39e921b7e), UINT64_C(0x5e2b4da90ff876b5),
+        UINT64_C(0x899f4e23ddb20719), UINT64_C(0xb694af694cd86ad2),
+        UINT64_C(0xf7888cb6ff66dc8f), UINT64_C(0xc8836dfc6e0cb144),
+        UINT64_C(0x75b0cb09981bb035), UINT64_C(0x4abb2a430971ddfe),
+        UINT64_C(0x0ba7099cbacf6ba3), UINT64_C(0x34ace8d62ba50668),
+        UINT64_C(0x3617a1a2b155967e), UINT64_C(0x091c40e8203ffbb5),
+        UINT64_C(0x4800633793814de8), UINT64_C(0x770b827d02eb2023),
+        UINT64_C(0xca382488f4fc2152), UINT64_C(0xf533c5c265964c99),
+        UINT64_C(0xb42fe61dd628fac4), UINT64_C(0x8b2407574742970f),
+        UINT64_C(0x5c9004dd9508e6a3), UINT64_C(0x639be59704628b68),
+        UINT64_C(0x2287c648b7dc3d35), UINT64_C(0x1d8c270226b650fe),
+        UINT64_C(0xa0bf81f7d0a1518f), UINT64_C(0x9fb460bd41cb3c44),
+        UINT64_C(0xdea84362f2758a19), UINT64_C(0xe1a3a228631fe7d2),
+        UINT64_C(0xdbded18bc794aa35), UINT64_C(0xe4d530c156fec7fe),
+        UINT64_C(0xa5c9131ee54071a3), UINT64_C(0x9ac2f254742a1c68),
+        UINT64_C(0x27f154a1823d1d19), UINT64_C(0x18fab5eb135770d2),
+        UINT64_C(0x59e69634a0e9c68f), UINT64_C(0x66ed777e3183ab44),
+        UINT64_C(0xb15974f4e3c9dae8), UINT64_C(0x8e5295be72a3b723),
+        UINT64_C(0xcf4eb661c11d017e), UINT64_C(0xf045572b50776cb5),
+        UINT64_C(0x4d76f1dea6606dc4), UINT64_C(0x727d1094370a000f),
+        UINT64_C(0x3361334b84b4b652), UINT64_C(0x0c6ad20115dedb99),
+        UINT64_C(0x0ed19b758f2e4b8f), UINT64_C(0x31da7a3f1e442644),
+        UINT64_C(0x70c659e0adfa9019), UINT64_C(0x4fcdb8aa3c90fdd2),
+        UINT64_C(0xf2fe1e5fca87fca3), UINT64_C(0xcdf5ff155bed9168),
+        UINT64_C(0x8ce9dccae8532735), UINT64_C(0xb3e23d8079394afe),
+        UINT64_C(0x64563e0aab733b52), UINT64_C(0x5b5ddf403a195699),
+        UINT64_C(0x1a41fc9f89a7e0c4), UINT64_C(0x254a1dd518cd8d0f),
+        UINT64_C(0x9879bb20eeda8c7e), UINT64_C(0xa7725a6a7fb0e1b5),
+        UINT64_C(0xe66e79b5cc0e57e8), UINT64_C(0xd96598ff5d643a23),
+        UINT64_C(0x92949ef28518cc26), UINT64_C(0xad9f7fb81472a1ed),
+        UINT64_C(0xec835c67a7cc17b0), UINT64_C(0xd388bd2d36a67a7b),
+        UINT64_C(0x6ebb1bd8c0b17b0a), UINT64_C(0x51b0fa9251db16c1),
+        UINT64_C(0x10acd94de265a09c), UINT64_C(0x2fa73807730fcd57),
+        UINT64_C(0xf8133b8da145bcfb), UINT64_C(0xc718dac7302fd130),
+        UINT64_C(0x8604f9188391676d), UINT64_C(0xb90f185212fb0aa6),
+        UINT64_C(0x043cbea7e4ec0bd7), UINT64_C(0x3b375fed7586661c),
+        UINT64_C(0x7a2b7c32c638d041), UINT64_C(0x45209d785752bd8a),
+        UINT64_C(0x479bd40ccda22d9c), UINT64_C(0x789035465cc84057),
+        UINT64_C(0x398c1699ef76f60a), UINT64_C(0x0687f7d37e1c9bc1),
+        UINT64_C(0xbbb45126880b9ab0), UINT64_C(0x84bfb06c1961f77b),
+        UINT64_C(0xc5a393b3aadf4126), UINT64_C(0xfaa872f93bb52ced),
+        UINT64_C(0x2d1c7173e9ff5d41), UINT64_C(0x121790397895308a),
+        UINT64_C(0x530bb3e6cb2b86d7), UINT64_C(0x6c0052ac5a41eb1c),
+        UINT64_C(0xd133f459ac56ea6d), UINT64_C(0xee3815133d3c87a6),
+        UINT64_C(0xaf2436cc8e8231fb), UINT64_C(0x902fd7861fe85c30),
+        UINT64_C(0xaa52a425bb6311d7), UINT64_C(0x9559456f2a097c1c),
+        UINT64_C(0xd44566b099b7ca41), UINT64_C(0xeb4e87fa08dda78a),
+        UINT64_C(0x567d210ffecaa6fb), UINT64_C(0x6976c0456fa0cb30),
+        UINT64_C(0x286ae39adc1e7d6d), UINT64_C(0x176102d04d7410a6),
+        UINT64_C(0xc0d5015a9f3e610a), UINT64_C(0xffdee0100e540cc1),
+        UINT64_C(0xbec2c3cfbdeaba9c), UINT64_C(0x81c922852c80d757),
+        UINT64_C(0x3cfa8470da97d626), UINT64_C(0x03f1653a4bfdbbed),
+        UINT64_C(0x42ed46e5f8430db0), UINT64_C(0x7de6a7af6929607b),
+        UINT64_C(0x7f5deedbf3d9f06d), UINT64_C(0x40560f9162b39da6),
+        UINT64_C(0x014a2c4ed10d2bfb), UINT64_C(0x3e41cd0440674630),
+        UINT64_C(0x83726bf1b6704741), UINT64_C(0xbc798abb271a2a8a),
+        UINT64_C(0xfd65a96494a49cd7), UINT64_C(0xc26e482e05cef11c),
+        UINT64_C(0x15da4ba4d78480b0), UINT64_C(0x2ad1aaee46eeed7b),
+        UINT64_C(0x6bcd8931f5505b26), UINT64_C(0x54c6687b643a36ed),
+        UINT64_C(0xe9f5ce8e922d379c), UINT64_C(0xd6fe2fc403475a57),
+        UINT64_C(0x97e20c1bb0f9ec0a), UINT64_C(0xa8e9ed51219381c1)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x1dee8a5e222ca1dc),
+        UINT64_C(0x3bdd14bc445943b8), UINT64_C(0x26339ee26675e264),
+        UINT64_C(0x77ba297888b28770), UINT64_C(0x6a54a326aa9e26ac),
+        UINT64_C(0x4c673dc4ccebc4c8), UINT64_C(0x5189b79aeec76514),
+        UINT64_C(0xef7452f111650ee0), UINT64_C(0xf29ad8af3349af3c),
+        UINT64_C(0xd4a9464d553c4d58), UINT64_C(0xc947cc137710ec84),
+        UINT64_C(0x98ce7b8999d78990), UINT64_C(0x8520f1d7bbfb284c),
+        UINT64_C(0xa3136f35dd8eca28), UINT64_C(0xbefde56bffa26bf4),
+        UINT64_C(0x4c300ac98dc40345), UINT64_C(0x51de8097afe8a299),
+        UINT64_C(0x77ed1e75c99d40fd), UINT64_C(0x6a03942bebb1e121),
+        UINT64_C(0x3b8a23b105768435), UINT64_C(0x2664a9ef275a25e9),
+        UINT64_C(0x0057370d412fc78d), UINT64_C(0x1db9bd5363036651),
+        UINT64_C(0xa34458389ca10da5), UINT64_C(0xbeaad266be8dac79),
+        UINT64_C(0x98994c84d8f84e1d), UINT64_C(0x8577c6dafad4efc1),
+        UINT64_C(0xd4fe714014138ad5), UINT64_C(0xc910fb1e363f2b09),
+        UINT64_C(0xef2365fc504ac96d), UINT64_C(0xf2cdefa2726668b1),
+        UINT64_C(0x986015931b88068a), UINT64_C(0x858e9fcd39a4a756),
+        UINT64_C(0xa3bd012f5fd14532), UINT64_C(0xbe538b717dfde4ee),
+        UINT64_C(0xefda3ceb933a81fa), UINT64_C(0xf234b6b5b1162026),
+        UINT64_C(0xd4072857d763c242), UINT64_C(0xc9e9a209f54f639e),
+        UINT64_C(0x771447620aed086a), UINT64_C(0x6afacd3c28c1a9b6),
+        UINT64_C(0x4cc953de4eb44bd2), UINT64_C(0x5127d9806c98ea0e),
+        UINT64_C(0x00ae6e1a825f8f1a), UINT64_C(0x1d40e444a0732ec6),
+        UINT64_C(0x3b737aa6c606cca2), UINT64_C(0x269df0f8e42a6d7e),
+        UINT64_C(0xd4501f5a964c05cf), UINT64_C(0xc9be9504b460a413),
+        UINT64_C(0xef8d0be6d2154677), UINT64_C(0xf26381b8f039e7ab),
+        UINT64_C(0xa3ea36221efe82bf), UINT64_C(0xbe04bc7c3cd22363),
+        UINT64_C(0x9837229e5aa7c107), UINT64_C(0x85d9a8c0788b60db),
+        UINT64_C(0x3b244dab87290b2f), UINT64_C(0x26cac7f5a505aaf3),
+        UINT64_C(0x00f95917c3704897), UINT64_C(0x1d17d349e15ce94b),
+        UINT64_C(0x4c9e64d30f9b8c5f), UINT64_C(0x5170ee8d2db72d83),
+        UINT64_C(0x7743706f4bc2cfe7), UINT64_C(0x6aadfa3169ee6e3b),
+        UINT64_C(0xa218840d981e1391), UINT64_C(0xbff60e53ba32b24d),
+        UINT64_C(0x99c590b1dc475029), UINT64_C(0x842b1aeffe6bf1f5),
+        UINT64_C(0xd5a2ad7510ac94e1), UINT64_C(0xc84c272b3280353d),
+        UINT64_C(0xee7fb9c954f5d759), UINT64_C(0xf391339776d97685),
+        UINT64_C(0x4d6cd6fc897b1d71), UINT64_C(0x50825ca2ab57bcad),
+        UINT64_C(0x76b1c240cd225ec9), UINT64_C(0x6b5f481eef0eff15),
+        UINT64_C(0x3ad6ff8401c99a01), UINT64_C(0x273875da23e53bdd),
+        UINT64_C(0x010beb384590d9b9), UINT64_C(0x1ce5616667bc7865),
+        UINT64_C(0xee288ec415da10d4), UINT64_C(0xf3c6049a37f6b108),
+        UINT64_C(0xd5f59a785183536c), UINT64_C(0xc81b102673aff2b0),
+        UINT64_C(0x9992a7bc9d6897a4), UINT64_C(0x847c2de2bf443678),
+        UINT64_C(0xa24fb300d931d41c), UINT64_C(0xbfa1395efb1d75c0),
+        UINT64_C(0x015cdc3504bf1e34), UINT64_C(0x1cb2566b2693bfe8),
+        UINT64_C(0x3a81c88940e65d8c), UINT64_C(0x276f42d762cafc50),
+        UINT64_C(0x76e6f54d8c0d9944), UINT64_C(0x6b087f13ae213898),
+        UINT64_C(0x4d3be1f1c854dafc), UINT64_C(0x50d56bafea787b20),
+        UINT64_C(0x3a78919e8396151b), UINT64_C(0x27961bc0a1bab4c7),
+        UINT64_C(0x01a58522c7cf56a3), UINT64_C(0x1c4b0f7ce5e3f77f),
+        UINT64_C(0x4dc2b8e60b24926b), UINT64_C(0x502c32b8290833b7),
+        UINT64_C(0x761fac5a4f7dd1d3), UINT64_C(0x6bf126046d51700f),
+        UINT64_C(0xd50cc36f92f31bfb), UINT64_C(0xc8e24931b0dfba27),
+        UINT64_C(0xeed1d7d3d6aa5843), UINT64_C(0xf33f5d8df486f99f),
+        UINT64_C(0xa2b6ea171a419c8b), UINT64_C(0xbf586049386d3d57),
+        UINT64_C(0x996bfeab5e18df33), UINT64_C(0x848574f57c347eef),
+        UINT64_C(0x76489b570e52165e), UINT64_C(0x6ba611092c7eb782),
+        UINT64_C(0x4d958feb4a0b55e6), UINT64_C(0x507b05b56827f43a),
+        UINT64_C(0x01f2b22f86e0912e), UINT64_C(0x1c1c3871a4cc30f2),
+        UINT64_C(0x3a2fa693c2b9d296), UINT64_C(0x27c12ccde095734a),
+        UINT64_C(0x993cc9a61f3718be), UINT64_C(0x84d243f83d1bb962),
+        UINT64_C(0xa2e1dd1a5b6e5b06), UINT64_C(0xbf0f57447942fada),
+        UINT64_C(0xee86e0de97859fce), UINT64_C(0xf3686a80b5a93e12),
+        UINT64_C(0xd55bf462d3dcdc76), UINT64_C(0xc8b57e3cf1f07daa),
+        UINT64_C(0xd6e9a7309f3239a7), UINT64_C(0xcb072d6ebd1e987b),
+        UINT64_C(0xed34b38cdb6b7a1f), UINT64_C(0xf0da39d2f947dbc3),
+        UINT64_C(0xa1538e481780bed7), UINT64_C(0xbcbd041635ac1f0b),
+        UINT64_C(0x9a8e9af453d9fd6f), UINT64_C(0x876010aa71f55cb3),
+        UINT64_C(0x399df5c18e573747), UINT64_C(0x24737f9fac7b969b),
+        UINT64_C(0x0240e17dca0e74ff), UINT64_C(0x1fae6b23e822d523),
+        UINT64_C(0x4e27dcb906e5b037), UINT64_C(0x53c956e724c911eb),
+        UINT64_C(0x75fac80542bcf38f), UINT64_C(0x6814425b60905253),
+        UINT64_C(0x9ad9adf912f63ae2), UINT64_C(0x873727a730da9b3e),
+        UINT64_C(0xa104b94556af795a), UINT64_C(0xbcea331b7483d886),
+        UINT64_C(0xed6384819a44bd92), UINT64_C(0xf08d0edfb8681c4e),
+        UINT64_C(0xd6be903dde1dfe2a), UINT64_C(0xcb501a63fc315ff6),
+        UINT64_C(0x75adff0803933402), UINT64_C(0x6843755621bf95de),
+        UINT64_C(0x4e70ebb447ca77ba), UINT64_C(0x539e61ea65e6d666),
+        UINT64_C(0x0217d6708b21b372), UINT64_C(0x1ff95c2ea90d12ae),
+        UINT64_C(0x39cac2cccf78f0ca), UINT64_C(0x24244892ed545116),
+        UINT64_C(0x4e89b2a384ba3f2d), UINT64_C(0x536738fda6969ef1),
+        UINT64_C(0x7554a61fc0e37c95), UINT64_C(0x68ba2c41e2cfdd49),
+        UINT64_C(0x39339bdb0c08b85d), UINT64_C(0x24dd11852e241981),
+        UINT64_C(0x02ee8f674851fbe5), UINT64_C(0x1f0005396a7d5a39),
+        UINT64_C(0xa1fde05295df31cd), UINT64_C(0xbc136a0cb7f39011),
+        UINT64_C(0x9a20f4eed1867275), UINT64_C(0x87ce7eb0f3aad3a9),
+        UINT64_C(0xd647c92a1d6db6bd), UINT64_C(0xcba943743f411761),
+        UINT64_C(0xed9add965934f505), UINT64_C(0xf07457c87b1854d9),
+        UINT64_C(0x02b9b86a097e3c68), UINT64_C(0x1f5732342b529db4),
+        UINT64_C(0x3964acd64d277fd0), UINT64_C(0x248a26886f0bde0c),
+        UINT64_C(0x7503911281ccbb18), UINT64_C(0x68ed1b4ca3e01ac4),
+        UINT64_C(0x4ede85aec595f8a0), UINT64_C(0x53300ff0e7b9597c),
+        UINT64_C(0xedcdea9b181b3288), UINT64_C(0xf02360c53a379354),
+        UINT64_C(0xd610fe275c427130), UINT64_C(0xcbfe74797e6ed0ec),
+        UINT64_C(0x9a77c3e390a9b5f8), UINT64_C(0x879949bdb2851424),
+        UINT64_C(0xa1aad75fd4f0f640), UINT64_C(0xbc445d01f6dc579c),
+        UINT64_C(0x74f1233d072c2a36), UINT64_C(0x691fa96325008bea),
+        UINT64_C(0x4f2c37814375698e), UINT64_C(0x52c2bddf6159c852),
+        UINT64_C(0x034b0a458f9ead46), UINT64_C(0x1ea5801badb20c9a),
+        UINT64_C(0x38961ef9cbc7eefe), UINT64_C(0x257894a7e9eb4f22),
+        UINT64_C(0x9b8571cc164924d6), UINT64_C(0x866bfb923465850a),
+        UINT64_C(0xa05865705210676e), UINT64_C(0xbdb6ef2e703cc6b2),
+        UINT64_C(0xec3f58b49efba3a6), UINT64_C(0xf1d1d2eabcd7027a),
+        UINT64_C(0xd7e24c08daa2e01e), UINT64_C(0xca0cc656f88e41c2),
+        UINT64_C(0x38c129f48ae82973), UINT64_C(0x252fa3aaa8c488af),
+        UINT64_C(0x031c3d48ceb16acb), UINT64_C(0x1ef2b716ec9dcb17),
+        UINT64_C(0x4f7b008c025aae03), UINT64_C(0x52958ad220760fdf),
+        UINT64_C(0x74a614304603edbb), UINT64_C(0x69489e6e642f4c67),
+        UINT64_C(0xd7b57b059b8d2793), UINT64_C(0xca5bf15bb9a1864f),
+        UINT64_C(0xec686fb9dfd4642b), UINT64_C(0xf186e5e7fdf8c5f7),
+        UINT64_C(0xa00f527d133fa0e3), UINT64_C(0xbde1d8233113013f),
+        UINT64_C(0x9bd246c15766e35b), UINT64_C(0x863ccc9f754a4287),
+        UINT64_C(0xec9136ae1ca42cbc), UINT64_C(0xf17fbcf03e888d60),
+        UINT64_C(0xd74c221258fd6f04), UINT64_C(0xcaa2a84c7ad1ced8),
+        UINT64_C(0x9b2b1fd69416abcc), UINT64_C(0x86c59588b63a0a10),
+        UINT64_C(0xa0f60b6ad04fe874), UINT64_C(0xbd188134f26349a8),
+        UINT64_C(0x03e5645f0dc1225c), UINT64_C(0x1e0bee012fed8380),
+        UINT64_C(0x383870e3499861e4), UINT64_C(0x25d6fabd6bb4c038),
+        UINT64_C(0x745f4d278573a52c), UINT64_C(0x69b1c779a75f04f0),
+        UINT64_C(0x4f82599bc12ae694), UINT64_C(0x526cd3c5e3064748),
+        UINT64_C(0xa0a13c6791602ff9), UINT64_C(0xbd4fb639b34c8e25),
+        UINT64_C(0x9b7c28dbd5396c41), UINT64_C(0x8692a285f715cd9d),
+        UINT64_C(0xd71b151f19d2a889), UINT64_C(0xcaf59f413bfe0955),
+        UINT64_C(0xecc601a35d8beb31), UINT64_C(0xf1288bfd7fa74aed),
+        UINT64_C(0x4fd56e9680052119), UINT64_C(0x523be4c8a22980c5),
+        UINT64_C(0x74087a2ac45c62a1), UINT64_C(0x69e6f074e670c37d),
+        UINT64_C(0x386f47ee08b7a669), UINT64_C(0x2581cdb02a9b07b5),
+        UINT64_C(0x03b253524ceee5d1), UINT64_C(0x1e5cd90c6ec2440d)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x5c2d776033c4205e),
+        UINT64_C(0xb85aeec0678840bc), UINT64_C(0xe47799a0544c60e2),
+        UINT64_C(0xe26d72ab601e9ffd), UINT64_C(0xbe4005cb53dabfa3),
+        UINT64_C(0x5a379c6b0796df41), UINT64_C(0x061aeb0b3452ff1f),
+        UINT64_C(0x56024a7d6f33217f), UINT64_C(0x0a2f3d1d5cf70121),
+        UINT64_C(0xee58a4bd08bb61c3), UINT64_C(0xb275d3dd3b7f419d),
+        UINT64_C(0xb46f38d60f2dbe82), UINT64_C(0xe8424fb63ce99edc),
+        UINT64_C(0x0c35d61668a5fe3e), UINT64_C(0x5018a1765b61de60),
+        UINT64_C(0xac0494fade6642fe), UINT64_C(0xf029e39aeda262a0),
+        UINT64_C(0x145e7a3ab9ee0242), UINT64_C(0x48730d5a8a2a221c),
+        UINT64_C(0x4e69e651be78dd03), UINT64_C(0x124491318dbcfd5d),
+        UINT64_C(0xf6330891d9f09dbf), UINT64_C(0xaa1e7ff1ea34bde1),
+        UINT64_C(0xfa06de87b1556381), UINT64_C(0xa62ba9e7829143df),
+        UINT64_C(0x425c3047d6dd233d), UINT64_C(0x1e714727e5190363),
+        UINT64_C(0x186bac2cd14bfc7c), UINT64_C(0x4446db4ce28fdc22),
+        UINT64_C(0xa03142ecb6c3bcc0), UINT64_C(0xfc1c358c85079c9e),
+        UINT64_C(0xcad186de13c29b79), UINT64_C(0x96fcf1be2006bb27),
+        UINT64_C(0x728b681e744adbc5), UINT64_C(0x2ea61f7e478efb9b),
+        UINT64_C(0x28bcf47573dc0484), UINT64_C(0x74918315401824da),
+        UINT64_C(0x90e61ab514544438), UINT64_C(0xcccb6dd527906466),
+        UINT64_C(0x9cd3cca37cf1ba06), UINT64_C(0xc0febbc34f359a58),
+        UINT64_C(0x248922631b79faba), UINT64_C(0x78a4550328bddae4),
+        UINT64_C(0x7ebebe081cef25fb), UINT64_C(0x2293c9682f2b05a5),
+        UINT64_C(0xc6e450c87b676547), UINT64_C(0x9ac927a848a34519),
+        UINT64_C(0x66d51224cda4d987), UINT64_C(0x3af86544fe60f9d9),
+        UINT64_C(0xde8ffce4aa2c993b), UINT64_C(0x82a28b8499e8b965),
+        UINT64_C(0x84b8608fadba467a), UINT64_C(0xd89517ef9e7e6624),
+        UINT64_C(0x3ce28e4fca3206c6), UINT64_C(0x60cff92ff9f62698),
+        UINT64_C(0x30d75859a297f8f8), UINT64_C(0x6cfa2f399153d8a6),
+        UINT64_C(0x888db699c51fb844), UINT64_C(0xd4a0c1f9f6db981a),
+        UINT64_C(0xd2ba2af2c2896705), UINT64_C(0x8e975d92f14d475b),
+        UINT64_C(0x6ae0c432a50127b9), UINT64_C(0x36cdb35296c507e7),
+        UINT64_C(0x077ba297888b2877), UINT64_C(0x5b56d5f7bb4f0829),
+        UINT64_C(0xbf214c57ef0368cb), UINT64_C(0xe30c3b37dcc74895),
+        UINT64_C(0xe516d03ce895b78a), UINT64_C(0xb93ba75cdb5197d4),
+        UINT64_C(0x5d4c3efc8f1df736), UINT64_C(0x0161499cbcd9d768),
+        UINT64_C(0x5179e8eae7b80908), UINT64_C(0x0d549f8ad47c2956),
+        UINT64_C(0xe923062a803049b4), UINT64_C(0xb50e714ab3f469ea),
+        UINT64_C(0xb3149a4187a696f5), UINT64_C(0xef39ed21b462b6ab),
+        UINT64_C(0x0b4e7481e02ed649), UINT64_C(0x576303e1d3eaf617),
+        UINT64_C(0xab7f366d56ed6a89), UINT64_C(0xf752410d65294ad7),
+        UINT64_C(0x1325d8ad31652a35), UINT64_C(0x4f08afcd02a10a6b),
+        UINT64_C(0x491244c636f3f574), UINT64_C(0x153f33a60537d52a),
+        UINT64_C(0xf148aa06517bb5c8), UINT64_C(0xad65dd6662bf9596),
+        UINT64_C(0xfd7d7c1039de4bf6), UINT64_C(0xa1500b700a1a6ba8),
+        UINT64_C(0x452792d05e560b4a), UINT64_C(0x190ae5b06d922b14),
+        UINT64_C(0x1f100ebb59c0d40b), UINT64_C(0x433d79db6a04f455),
+        UINT64_C(0xa74ae07b3e4894b7), UINT64_C(0xfb67971b0d8cb4e9),
+        UINT64_C(0xcdaa24499b49b30e), UINT64_C(0x91875329a88d9350),
+        UINT64_C(0x75f0ca89fcc1f3b2), UINT64_C(0x29ddbde9cf05d3ec),
+        UINT64_C(0x2fc756e2fb572cf3), UINT64_C(0x73ea2182c8930cad),
+        UINT64_C(0x979db8229cdf6c4f), UINT64_C(0xcbb0cf42af1b4c11),
+        UINT64_C(0x9ba86e34f47a9271), UINT64_C(0xc7851954c7beb22f),
+        UINT64_C(0x23f280f493f2d2cd), UINT64_C(0x7fdff794a036f293),
+        UINT64_C(0x79c51c9f94640d8c), UINT64_C(0x25e86bffa7a02dd2),
+        UINT64_C(0xc19ff25ff3ec4d30), UINT64_C(0x9db2853fc0286d6e),
+        UINT64_C(0x61aeb0b3452ff1f0), UINT64_C(0x3d83c7d376ebd1ae),
+        UINT64_C(0xd9f45e7322a7b14c), UINT64_C(0x85d9291311639112),
+        UINT64_C(0x83c3c21825316e0d), UINT64_C(0xdfeeb57816f54e53),
+        UINT64_C(0x3b992cd842b92eb1), UINT64_C(0x67b45bb8717d0eef),
+        UINT64_C(0x37acface2a1cd08f), UINT64_C(0x6b818dae19d8f0d1),
+        UINT64_C(0x8ff6140e4d949033), UINT64_C(0xd3db636e7e50b06d),
+        UINT64_C(0xd5c188654a024f72), UINT64_C(0x89ecff0579c66f2c),
+        UINT64_C(0x6d9b66a52d8a0fce), UINT64_C(0x31b611c51e4e2f90),
+        UINT64_C(0x0ef7452f111650ee), UINT64_C(0x52da324f22d270b0),
+        UINT64_C(0xb6adabef769e1052), UINT64_C(0xea80dc8f455a300c),
+        UINT64_C(0xec9a37847108cf13), UINT64_C(0xb0b740e442ccef4d),
+        UINT64_C(0x54c0d94416808faf), UINT64_C(0x08edae242544aff1),
+        UINT64_C(0x58f50f527e257191), UINT64_C(0x04d878324de151cf),
+        UINT64_C(0xe0afe19219ad312d), UINT64_C(0xbc8296f22a691173),
+        UINT64_C(0xba987df91e3bee6c), UINT64_C(0xe6b50a992dffce32),
+        UINT64_C(0x02c2933979b3aed0), UINT64_C(0x5eefe4594a778e8e),
+        UINT64_C(0xa2f3d1d5cf701210), UINT64_C(0xfedea6b5fcb4324e),
+        UINT64_C(0x1aa93f15a8f852ac), UINT64_C(0x468448759b3c72f2),
+        UINT64_C(0x409ea37eaf6e8ded), UINT64_C(0x1cb3d41e9caaadb3),
+        UINT64_C(0xf8c44dbec8e6cd51), UINT64_C(0xa4e93adefb22ed0f),
+        UINT64_C(0xf4f19ba8a043336f), UINT64_C(0xa8dcecc893871331),
+        UINT64_C(0x4cab7568c7cb73d3), UINT64_C(0x10860208f40f538d),
+        UINT64_C(0x169ce903c05dac92), UINT64_C(0x4ab19e63f3998ccc),
+        UINT64_C(0xaec607c3a7d5ec2e), UINT64_C(0xf2eb70a39411cc70),
+        UINT64_C(0xc426c3f102d4cb97), UINT64_C(0x980bb4913110ebc9),
+        UINT64_C(0x7c7c2d31655c8b2b), UINT64_C(0x20515a515698ab75),
+        UINT64_C(0x264bb15a62ca546a), UINT64_C(0x7a66c63a510e7434),
+        UINT64_C(0x9e115f9a054214d6), UINT64_C(0xc23c28fa36863488),
+        UINT64_C(0x9224898c6de7eae8), UINT64_C(0xce09feec5e23cab6),
+        UINT64_C(0x2a7e674c0a6faa54), UINT64_C(0x7653102c39ab8a0a),
+        UINT64_C(0x7049fb270df97515), UINT64_C(0x2c648c473e3d554b),
+        UINT64_C(0xc81315e76a7135a9), UINT64_C(0x943e628759b515f7),
+        UINT64_C(0x6822570bdcb28969), UINT64_C(0x340f206bef76a937),
+        UINT64_C(0xd078b9cbbb3ac9d5), UINT64_C(0x8c55ceab88fee98b),
+        UINT64_C(0x8a4f25a0bcac1694), UINT64_C(0xd66252c08f6836ca),
+        UINT64_C(0x3215cb60db245628), UINT64_C(0x6e38bc00e8e07676),
+        UINT64_C(0x3e201d76b381a816), UINT64_C(0x620d6a1680458848),
+        UINT64_C(0x867af3b6d409e8aa), UINT64_C(0xda5784d6e7cdc8f4),
+        UINT64_C(0xdc4d6fddd39f37eb), UINT64_C(0x806018bde05b17b5),
+        UINT64_C(0x6417811db4177757), UINT64_C(0x383af67d87d35709),
+        UINT64_C(0x098ce7b8999d7899), UINT64_C(0x55a190d8aa5958c7),
+        UINT64_C(0xb1d60978fe153825), UINT64_C(0xedfb7e18cdd1187b),
+        UINT64_C(0xebe19513f983e764), UINT64_C(0xb7cce273ca47c73a),
+        UINT64_C(0x53bb7bd39e0ba7d8), UINT64_C(0x0f960cb3adcf8786),
+        UINT64_C(0x5f8eadc5f6ae59e6), UINT64_C(0x03a3daa5c56a79b8),
+        UINT64_C(0xe7d443059126195a), UINT64_C(0xbbf93465a2e23904),
+        UINT64_C(0xbde3df6e96b0c61b), UINT64_C(0xe1cea80ea574e645),
+        UINT64_C(0x05b931aef13886a7), UINT64_C(0x599446cec2fca6f9),
+        UINT64_C(0xa588734247fb3a67), UINT64_C(0xf9a50422743f1a39),
+        UINT64_C(0x1dd29d8220737adb), UINT64_C(0x41ffeae213b75a85),
+        UINT64_C(0x47e501e927e5a59a), UINT64_C(0x1bc87689142185c4),
+        UINT64_C(0xffbfef29406de526), UINT64_C(0xa392984973a9c578),
+        UINT64_C(0xf38a393f28c81b18), UINT64_C(0xafa74e5f1b0c3b46),
+        UINT64_C(0x4bd0d7ff4f405ba4), UINT64_C(0x17fda09f7c847bfa),
+        UINT64_C(0x11e74b9448d684e5), UINT64_C(0x4dca3cf47b12a4bb),
+        UINT64_C(0xa9bda5542f5ec459), UINT64_C(0xf590d2341c9ae407),
+        UINT64_C(0xc35d61668a5fe3e0), UINT64_C(0x9f701606b99bc3be),
+        UINT64_C(0x7b078fa6edd7a35c), UINT64_C(0x272af8c6de138302),
+        UINT64_C(0x213013cdea417c1d), UINT64_C(0x7d1d64add9855c43),
+        UINT64_C(0x996afd0d8dc93ca1), UINT64_C(0xc5478a6dbe0d1cff),
+        UINT64_C(0x955f2b1be56cc29f), UINT64_C(0xc9725c7bd6a8e2c1),
+        UINT64_C(0x2d05c5db82e48223), UINT64_C(0x7128b2bbb120a27d),
+        UINT64_C(0x773259b085725d62), UINT64_C(0x2b1f2ed0b6b67d3c),
+        UINT64_C(0xcf68b770e2fa1dde), UINT64_C(0x9345c010d13e3d80),
+        UINT64_C(0x6f59f59c5439a11e), UINT64_C(0x337482fc67fd8140),
+        UINT64_C(0xd7031b5c33b1e1a2), UINT64_C(0x8b2e6c3c0075c1fc),
+        UINT64_C(0x8d34873734273ee3), UINT64_C(0xd119f05707e31ebd),
+        UINT64_C(0x356e69f753af7e5f), UINT64_C(0x69431e97606b5e01),
+        UINT64_C(0x395bbfe13b0a8061), UINT64_C(0x6576c88108cea03f),
+        UINT64_C(0x810151215c82c0dd), UINT64_C(0xdd2c26416f46e083),
+        UINT64_C(0xdb36cd4a5b141f9c), UINT64_C(0x871bba2a68d03fc2),
+        UINT64_C(0x636c238a3c9c5f20), UINT64_C(0x3f4154ea0f587f7e)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x6184d55f721267c6),
+        UINT64_C(0xc309aabee424cf8c), UINT64_C(0xa28d7fe19636a84a),
+        UINT64_C(0x14cbfa566747819d), UINT64_C(0x754f2f091555e65b),
+        UINT64_C(0xd7c250e883634e11), UINT64_C(0xb64685b7f17129d7),
+        UINT64_C(0x2997f4acce8f033a), UINT64_C(0x481321f3bc9d64fc),
+        UINT64_C(0xea9e5e122aabccb6), UINT64_C(0x8b1a8b4d58b9ab70),
+        UINT64_C(0x3d5c0efaa9c882a7), UINT64_C(0x5cd8dba5dbdae561),
+        UINT64_C(0xfe55a4444dec4d2b), UINT64_C(0x9fd1711b3ffe2aed),
+        UINT64_C(0x532fe9599d1e0674), UINT64_C(0x32ab3c06ef0c61b2),
+        UINT64_C(0x902643e7793ac9f8), UINT64_C(0xf1a296b80b28ae3e),
+        UINT64_C(0x47e4130ffa5987e9), UINT64_C(0x2660c650884be02f),
+        UINT64_C(0x84edb9b11e7d4865), UINT64_C(0xe5696cee6c6f2fa3),
+        UINT64_C(0x7ab81df55391054e), UINT64_C(0x1b3cc8aa21836288),
+        UINT64_C(0xb9b1b74bb7b5cac2), UINT64_C(0xd8356214c5a7ad04),
+        UINT64_C(0x6e73e7a334d684d3), UINT64_C(0x0ff732fc46c4e315),
+        UINT64_C(0xad7a4d1dd0f24b5f), UINT64_C(0xccfe9842a2e02c99),
+        UINT64_C(0xa65fd2b33a3c0ce8), UINT64_C(0xc7db07ec482e6b2e),
+        UINT64_C(0x6556780dde18c364), UINT64_C(0x04d2ad52ac0aa4a2),
+        UINT64_C(0xb29428e55d7b8d75), UINT64_C(0xd310fdba2f69eab3),
+        UINT64_C(0x719d825bb95f42f9), UINT64_C(0x10195704cb4d253f),
+        UINT64_C(0x8fc8261ff4b30fd2), UINT64_C(0xee4cf34086a16814),
+        UINT64_C(0x4cc18ca11097c05e), UINT64_C(0x2d4559fe6285a798),
+        UINT64_C(0x9b03dc4993f48e4f), UINT64_C(0xfa870916e1e6e989),
+        UINT64_C(0x580a76f777d041c3), UINT64_C(0x398ea3a805c22605),
+        UINT64_C(0xf5703beaa7220a9c), UINT64_C(0x94f4eeb5d5306d5a),
+        UINT64_C(0x367991544306c510), UINT64_C(0x57fd440b3114a2d6),
+        UINT64_C(0xe1bbc1bcc0658b01), UINT64_C(0x803f14e3b277ecc7),
+        UINT64_C(0x22b26b022441448d), UINT64_C(0x4336be5d5653234b),
+        UINT64_C(0xdce7cf4669ad09a6), UINT64_C(0xbd631a191bbf6e60),
+        UINT64_C(0x1fee65f88d89c62a), UINT64_C(0x7e6ab0a7ff9ba1ec),
+        UINT64_C(0xc82c35100eea883b), UINT64_C(0xa9a8e04f7cf8effd),
+        UINT64_C(0x0b259faeeace47b7), UINT64_C(0x6aa14af198dc2071),
+        UINT64_C(0xde670a4ddb760755), UINT64_C(0xbfe3df12a9646093),
+        UINT64_C(0x1d6ea0f33f52c8d9), UINT64_C(0x7cea75ac4d40af1f),
+        UINT64_C(0xcaacf01bbc3186c8), UINT64_C(0xab282544ce23e10e),
+        UINT64_C(0x09a55aa558154944), UINT64_C(0x68218ffa2a072e82),
+        UINT64_C(0xf7f0fee115f9046f), UINT64_C(0x96742bbe67eb63a9),
+        UINT64_C(0x34f9545ff1ddcbe3), UINT64_C(0x557d810083cfac25),
+        UINT64_C(0xe33b04b772be85f2), UINT64_C(0x82bfd1e800ace234),
+        UINT64_C(0x2032ae09969a4a7e), UINT64_C(0x41b67b56e4882db8),
+        UINT64_C(0x8d48e31446680121), UINT64_C(0xeccc364b347a66e7),
+        UINT64_C(0x4e4149aaa24ccead), UINT64_C(0x2fc59cf5d05ea96b),
+        UINT64_C(0x99831942212f80bc), UINT64_C(0xf807cc1d533de77a),
+        UINT64_C(0x5a8ab3fcc50b4f30), UINT64_C(0x3b0e66a3b71928f6),
+        UINT64_C(0xa4df17b888e7021b), UINT64_C(0xc55bc2e7faf565dd),
+        UINT64_C(0x67d6bd066cc3cd97), UINT64_C(0x065268591ed1aa51),
+        UINT64_C(0xb014edeeefa08386), UINT64_C(0xd19038b19db2e440),
+        UINT64_C(0x731d47500b844c0a), UINT64_C(0x1299920f79962bcc),
+        UINT64_C(0x7838d8fee14a0bbd), UINT64_C(0x19bc0da193586c7b),
+        UINT64_C(0xbb317240056ec431), UINT64_C(0xdab5a71f777ca3f7),
+        UINT64_C(0x6cf322a8860d8a20), UINT64_C(0x0d77f7f7f41fede6),
+        UINT64_C(0xaffa8816622945ac), UINT64_C(0xce7e5d49103b226a),
+        UINT64_C(0x51af2c522fc50887), UINT64_C(0x302bf90d5dd76f41),
+        UINT64_C(0x92a686eccbe1c70b), UINT64_C(0xf32253b3b9f3a0cd),
+        UINT64_C(0x4564d6044882891a), UINT64_C(0x24e0035b3a90eedc),
+        UINT64_C(0x866d7cbaaca64696), UINT64_C(0xe7e9a9e5deb42150),
+        UINT64_C(0x2b1731a77c540dc9), UINT64_C(0x4a93e4f80e466a0f),
+        UINT64_C(0xe81e9b199870c245), UINT64_C(0x899a4e46ea62a583),
+        UINT64_C(0x3fdccbf11b138c54), UINT64_C(0x5e581eae6901eb92),
+        UINT64_C(0xfcd5614fff3743d8), UINT64_C(0x9d51b4108d25241e),
+        UINT64_C(0x0280c50bb2db0ef3), UINT64_C(0x63041054c0c96935),
+        UINT64_C(0xc1896fb556ffc17f), UINT64_C(0xa00dbaea24eda6b9),
+        UINT64_C(0x164b3f5dd59c8f6e), UINT64_C(0x77cfea02a78ee8a8),
+        UINT64_C(0xd54295e331b840e2), UINT64_C(0xb4c640bc43aa2724),
+        UINT64_C(0x2e16bbb019e2102f), UINT64_C(0x4f926eef6bf077e9),
+        UINT64_C(0xed1f110efdc6dfa3), UINT64_C(0x8c9bc4518fd4b865),
+        UINT64_C(0x3add41e67ea591b2), UINT64_C(0x5b5994b90cb7f674),
+        UINT64_C(0xf9d4eb589a815e3e), UINT64_C(0x98503e07e89339f8),
+        UINT64_C(0x07814f1cd76d1315), UINT64_C(0x66059a43a57f74d3),
+        UINT64_C(0xc488e5a23349dc99), UINT64_C(0xa50c30fd415bbb5f),
+        UINT64_C(0x134ab54ab02a9288), UINT64_C(0x72ce6015c238f54e),
+        UINT64_C(0xd0431ff4540e5d04), UINT64_C(0xb1c7caab261c3ac2),
+        UINT64_C(0x7d3952e984fc165b), UINT64_C(0x1cbd87b6f6ee719d),
+        UINT64_C(0xbe30f85760d8d9d7), UINT64_C(0xdfb42d0812cabe11),
+        UINT64_C(0x69f2a8bfe3bb97c6), UINT64_C(0x08767de091a9f000),
+        UINT64_C(0xaafb0201079f584a), UINT64_C(0xcb7fd75e758d3f8c),
+        UINT64_C(0x54aea6454a731561), UINT64_C(0x352a731a386172a7),
+        UINT64_C(0x97a70cfbae57daed), UINT64_C(0xf623d9a4dc45bd2b),
+        UINT64_C(0x40655c132d3494fc), UINT64_C(0x21e1894c5f26f33a),
+        UINT64_C(0x836cf6adc9105b70), UINT64_C(0xe2e823f2bb023cb6),
+        UINT64_C(0x8849690323de1cc7), UINT64_C(0xe9cdbc5c51cc7b01),
+        UINT64_C(0x4b40c3bdc7fad34b), UINT64_C(0x2ac416e2b5e8b48d),
+        UINT64_C(0x9c82935544999d5a), UINT64_C(0xfd06460a368bfa9c),
+        UINT64_C(0x5f8b39eba0bd52d6), UINT64_C(0x3e0fecb4d2af3510),
+        UINT64_C(0xa1de9dafed511ffd), UINT64_C(0xc05a48f09f43783b),
+        UINT64_C(0x62d737110975d071), UINT64_C(0x0353e24e7b67b7b7),
+        UINT64_C(0xb51567f98a169e60), UINT64_C(0xd491b2a6f804f9a6),
+        UINT64_C(0x761ccd476e3251ec), UINT64_C(0x179818181c20362a),
+        UINT64_C(0xdb66805abec01ab3), UINT64_C(0xbae25505ccd27d75),
+        UINT64_C(0x186f2ae45ae4d53f), UINT64_C(0x79ebffbb28f6b2f9),
+        UINT64_C(0xcfad7a0cd9879b2e), UINT64_C(0xae29af53ab95fce8),
+        UINT64_C(0x0ca4d0b23da354a2), UINT64_C(0x6d2005ed4fb13364),
+        UINT64_C(0xf2f174f6704f1989), UINT64_C(0x9375a1a9025d7e4f),
+        UINT64_C(0x31f8de48946bd605), UINT64_C(0x507c0b17e679b1c3),
+        UINT64_C(0xe63a8ea017089814), UINT64_C(0x87be5bff651affd2),
+        UINT64_C(0x2533241ef32c5798), UINT64_C(0x44b7f141813e305e),
+        UINT64_C(0xf071b1fdc294177a), UINT64_C(0x91f564a2b08670bc),
+        UINT64_C(0x33781b4326b0d8f6), UINT64_C(0x52fcce1c54a2bf30),
+        UINT64_C(0xe4ba4baba5d396e7), UINT64_C(0x853e9ef4d7c1f121),
+        UINT64_C(0x27b3e11541f7596b), UINT64_C(0x4637344a33e53ead),
+        UINT64_C(0xd9e645510c1b1440), UINT64_C(0xb862900e7e097386),
+        UINT64_C(0x1aefefefe83fdbcc), UINT64_C(0x7b6b3ab09a2dbc0a),
+        UINT64_C(0xcd2dbf076b5c95dd), UINT64_C(0xaca96a58194ef21b),
+        UINT64_C(0x0e2415b98f785a51), UINT64_C(0x6fa0c0e6fd6a3d97),
+        UINT64_C(0xa35e58a45f8a110e), UINT64_C(0xc2da8dfb2d9876c8),
+        UINT64_C(0x6057f21abbaede82), UINT64_C(0x01d32745c9bcb944),
+        UINT64_C(0xb795a2f238cd9093), UINT64_C(0xd61177ad4adff755),
+        UINT64_C(0x749c084cdce95f1f), UINT64_C(0x1518dd13aefb38d9),
+        UINT64_C(0x8ac9ac0891051234), UINT64_C(0xeb4d7957e31775f2),
+        UINT64_C(0x49c006b67521ddb8), UINT64_C(0x2844d3e90733ba7e),
+        UINT64_C(0x9e02565ef64293a9), UINT64_C(0xff8683018450f46f),
+        UINT64_C(0x5d0bfce012665c25), UINT64_C(0x3c8f29bf60743be3),
+        UINT64_C(0x562e634ef8a81b92), UINT64_C(0x37aab6118aba7c54),
+        UINT64_C(0x9527c9f01c8cd41e), UINT64_C(0xf4a31caf6e9eb3d8),
+        UINT64_C(0x42e599189fef9a0f), UINT64_C(0x23614c47edfdfdc9),
+        UINT64_C(0x81ec33a67bcb5583), UINT64_C(0xe068e6f909d93245),
+        UINT64_C(0x7fb997e2362718a8), UINT64_C(0x1e3d42bd44357f6e),
+        UINT64_C(0xbcb03d5cd203d724), UINT64_C(0xdd34e803a011b0e2),
+        UINT64_C(0x6b726db451609935), UINT64_C(0x0af6b8eb2372fef3),
+        UINT64_C(0xa87bc70ab54456b9), UINT64_C(0xc9ff1255c756317f),
+        UINT64_C(0x05018a1765b61de6), UINT64_C(0x64855f4817a47a20),
+        UINT64_C(0xc60820a98192d26a), UINT64_C(0xa78cf5f6f380b5ac),
+        UINT64_C(0x11ca704102f19c7b), UINT64_C(0x704ea51e70e3fbbd),
+        UINT64_C(0xd2c3daffe6d553f7), UINT64_C(0xb3470fa094c73431),
+        UINT64_C(0x2c967ebbab391edc), UINT64_C(0x4d12abe4d92b791a),
+        UINT64_C(0xef9fd4054f1dd150), UINT64_C(0x8e1b015a3d0fb696),
+        UINT64_C(0x385d84edcc7e9f41), UINT64_C(0x59d951b2be6cf887),
+        UINT64_C(0xfb542e53285a50cd), UINT64_C(0x9ad0fb0c5a48370b)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x22ef0d5934f964ec),
+        UINT64_C(0x45de1ab269f2c9d8), UINT64_C(0x673117eb5d0bad34),
+        UINT64_C(0x8bbc3564d3e593b0), UINT64_C(0xa953383de71cf75c),
+        UINT64_C(0xce622fd6ba175a68), UINT64_C(0xec8d228f8eee3e84),
+        UINT64_C(0x85a0c5e208c539e5), UINT64_C(0xa74fc8bb3c3c5d09),
+        UINT64_C(0xc07edf506137f03d), UINT64_C(0xe291d20955ce94d1),
+        UINT64_C(0x0e1cf086db20aa55), UINT64_C(0x2cf3fddfefd9ceb9),
+        UINT64_C(0x4bc2ea34b2d2638d), UINT64_C(0x692de76d862b0761),
+        UINT64_C(0x999924efbe846d4f), UINT64_C(0xbb7629b68a7d09a3),
+        UINT64_C(0xdc473e5dd776a497), UINT64_C(0xfea83304e38fc07b),
+        UINT64_C(0x1225118b6d61feff), UINT64_C(0x30ca1cd259989a13),
+        UINT64_C(0x57fb0b3904933727), UINT64_C(0x75140660306a53cb),
+        UINT64_C(0x1c39e10db64154aa), UINT64_C(0x3ed6ec5482b83046),
+        UINT64_C(0x59e7fbbfdfb39d72), UINT64_C(0x7b08f6e6eb4af99e),
+        UINT64_C(0x9785d46965a4c71a), UINT64_C(0xb56ad930515da3f6),
+        UINT64_C(0xd25bcedb0c560ec2), UINT64_C(0xf0b4c38238af6a2e),
+        UINT64_C(0xa1eae6f4d206c41b), UINT64_C(0x8305ebade6ffa0f7),
+        UINT64_C(0xe434fc46bbf40dc3), UINT64_C(0xc6dbf11f8f0d692f),
+        UINT64_C(0x2a56d39001e357ab), UINT64_C(0x08b9dec9351a3347),
+        UINT64_C(0x6f88c92268119e73), UINT64_C(0x4d67c47b5ce8fa9f),
+        UINT64_C(0x244a2316dac3fdfe), UINT64_C(0x06a52e4fee3a9912),
+        UINT64_C(0x619439a4b3313426), UINT64_C(0x437b34fd87c850ca),
+        UINT64_C(0xaff6167209266e4e), UINT64_C(0x8d191b2b3ddf0aa2),
+        UINT64_C(0xea280cc060d4a796), UINT64_C(0xc8c70199542dc37a),
+        UINT64_C(0x3873c21b6c82a954), UINT64_C(0x1a9ccf42587bcdb8),
+        UINT64_C(0x7dadd8a90570608c), UINT64_C(0x5f42d5f031890460),
+        UINT64_C(0xb3cff77fbf673ae4), UINT64_C(0x9120fa268b9e5e08),
+        UINT64_C(0xf611edcdd695f33c), UINT64_C(0xd4fee094e26c97d0),
+        UINT64_C(0xbdd307f9644790b1), UINT64_C(0x9f3c0aa050bef45d),
+        UINT64_C(0xf80d1d4b0db55969), UINT64_C(0xdae21012394c3d85),
+        UINT64_C(0x366f329db7a20301), UINT64_C(0x14803fc4835b67ed),
+        UINT64_C(0x73b1282fde50cad9), UINT64_C(0x515e2576eaa9ae35),
+        UINT64_C(0xd10d62c20b0396b3), UINT64_C(0xf3e26f9b3ffaf25f),
+        UINT64_C(0x94d3787062f15f6b), UINT64_C(0xb63c752956083b87),
+        UINT64_C(0x5ab157a6d8e60503), UINT64_C(0x785e5affec1f61ef),
+        UINT64_C(0x1f6f4d14b114ccdb), UINT64_C(0x3d80404d85eda837),
+        UINT64_C(0x54ada72003c6af56), UINT64_C(0x7642aa79373fcbba),
+        UINT64_C(0x1173bd926a34668e), UINT64_C(0x339cb0cb5ecd0262),
+        UINT64_C(0xdf119244d0233ce6), UINT64_C(0xfdfe9f1de4da580a),
+        UINT64_C(0x9acf88f6b9d1f53e), UINT64_C(0xb82085af8d2891d2),
+        UINT64_C(0x4894462db587fbfc), UINT64_C(0x6a7b4b74817e9f10),
+        UINT64_C(0x0d4a5c9fdc753224), UINT64_C(0x2fa551c6e88c56c8),
+        UINT64_C(0xc32873496662684c), UINT64_C(0xe1c77e10529b0ca0),
+        UINT64_C(0x86f669fb0f90a194), UINT64_C(0xa41964a23b69c578),
+        UINT64_C(0xcd3483cfbd42c219), UINT64_C(0xefdb8e9689bba6f5),
+        UINT64_C(0x88ea997dd4b00bc1), UINT64_C(0xaa059424e0496f2d),
+        UINT64_C(0x4688b6ab6ea751a9), UINT64_C(0x6467bbf25a5e3545),
+        UINT64_C(0x0356ac1907559871), UINT64_C(0x21b9a14033acfc9d),
+        UINT64_C(0x70e78436d90552a8), UINT64_C(0x5208896fedfc3644),
+        UINT64_C(0x35399e84b0f79b70), UINT64_C(0x17d693dd840eff9c),
+        UINT64_C(0xfb5bb1520ae0c118), UINT64_C(0xd9b4bc0b3e19a5f4),
+        UINT64_C(0xbe85abe0631208c0), UINT64_C(0x9c6aa6b957eb6c2c),
+        UINT64_C(0xf54741d4d1c06b4d), UINT64_C(0xd7a84c8de5390fa1),
+        UINT64_C(0xb0995b66b832a295), UINT64_C(0x9276563f8ccbc679),
+        UINT64_C(0x7efb74b00225f8fd), UINT64_C(0x5c1479e936dc9c11),
+        UINT64_C(0x3b256e026bd73125), UINT64_C(0x19ca635b5f2e55c9),
+        UINT64_C(0xe97ea0d967813fe7), UINT64_C(0xcb91ad8053785b0b),
+        UINT64_C(0xaca0ba6b0e73f63f), UINT64_C(0x8e4fb7323a8a92d3),
+        UINT64_C(0x62c295bdb464ac57), UINT64_C(0x402d98e4809dc8bb),
+        UINT64_C(0x271c8f0fdd96658f), UINT64_C(0x05f38256e96f0163),
+        UINT64_C(0x6cde653b6f440602), UINT64_C(0x4e3168625bbd62ee),
+        UINT64_C(0x29007f8906b6cfda), UINT64_C(0x0bef72d0324fab36),
+        UINT64_C(0xe762505fbca195b2), UINT64_C(0xc58d5d068858f15e),
+        UINT64_C(0xa2bc4aedd5535c6a), UINT64_C(0x805347b4e1aa3886),
+        UINT64_C(0x30c26aafb90933e3), UINT64_C(0x122d67f68df0570f),
+        UINT64_C(0x751c701dd0fbfa3b), UINT64_C(0x57f37d44e4029ed7),
+        UINT64_C(0xbb7e5fcb6aeca053), UINT64_C(0x999152925e15c4bf),
+        UINT64_C(0xfea04579031e698b), UINT64_C(0xdc4f482037e70d67),
+        UINT64_C(0xb562af4db1cc0a06), UINT64_C(0x978da21485356eea),
+        UINT64_C(0xf0bcb5ffd83ec3de), UINT64_C(0xd253b8a6ecc7a732),
+        UINT64_C(0x3ede9a29622999b6), UINT64_C(0x1c31977056d0fd5a),
+        UINT64_C(0x7b00809b0bdb506e), UINT64_C(0x59ef8dc23f223482),
+        UINT64_C(0xa95b4e40078d5eac), UINT64_C(0x8bb4431933743a40),
+        UINT64_C(0xec8554f26e7f9774), UINT64_C(0xce6a59ab5a86f398),
+        UINT64_C(0x22e77b24d468cd1c), UINT64_C(0x0008767de091a9f0),
+        UINT64_C(0x67396196bd9a04c4), UINT64_C(0x45d66ccf89636028),
+        UINT64_C(0x2cfb8ba20f486749), UINT64_C(0x0e1486fb3bb103a5),
+        UINT64_C(0x6925911066baae91), UINT64_C(0x4bca9c495243ca7d),
+        UINT64_C(0xa747bec6dcadf4f9), UINT64_C(0x85a8b39fe8549015),
+        UINT64_C(0xe299a474b55f3d21), UINT64_C(0xc076a92d81a659cd),
+        UINT64_C(0x91288c5b6b0ff7f8), UINT64_C(0xb3c781025ff69314),
+        UINT64_C(0xd4f696e902fd3e20), UINT64_C(0xf6199bb036045acc),
+        UINT64_C(0x1a94b93fb8ea6448), UINT64_C(0x387bb4668c1300a4),
+        UINT64_C(0x5f4aa38dd118ad90), UINT64_C(0x7da5aed4e5e1c97c),
+        UINT64_C(0x148849b963cace1d), UINT64_C(0x366744e05733aaf1),
+        UINT64_C(0x5156530b0a3807c5), UINT64_C(0x73b95e523ec16329),
+        UINT64_C(0x9f347cddb02f5dad), UINT64_C(0xbddb718484d63941),
+        UINT64_C(0xdaea666fd9dd9475), UINT64_C(0xf8056b36ed24f099),
+        UINT64_C(0x08b1a8b4d58b9ab7), UINT64_C(0x2a5ea5ede172fe5b),
+        UINT64_C(0x4d6fb206bc79536f), UINT64_C(0x6f80bf5f88803783),
+        UINT64_C(0x830d9dd0066e0907), UINT64_C(0xa1e2908932976deb),
+        UINT64_C(0xc6d387626f9cc0df), UINT64_C(0xe43c8a3b5b65a433),
+        UINT64_C(0x8d116d56dd4ea352), UINT64_C(0xaffe600fe9b7c7be),
+        UINT64_C(0xc8cf77e4b4bc6a8a), UINT64_C(0xea207abd80450e66),
+        UINT64_C(0x06ad58320eab30e2), UINT64_C(0x2442556b3a52540e),
+        UINT64_C(0x437342806759f93a), UINT64_C(0x619c4fd953a09dd6),
+        UINT64_C(0xe1cf086db20aa550), UINT64_C(0xc320053486f3c1bc),
+        UINT64_C(0xa41112dfdbf86c88), UINT64_C(0x86fe1f86ef010864),
+        UINT64_C(0x6a733d0961ef36e0), UINT64_C(0x489c30505516520c),
+        UINT64_C(0x2fad27bb081dff38), UINT64_C(0x0d422ae23ce49bd4),
+        UINT64_C(0x646fcd8fbacf9cb5), UINT64_C(0x4680c0d68e36f859),
+        UINT64_C(0x21b1d73dd33d556d), UINT64_C(0x035eda64e7c43181),
+        UINT64_C(0xefd3f8eb692a0f05), UINT64_C(0xcd3cf5b25dd36be9),
+        UINT64_C(0xaa0de25900d8c6dd), UINT64_C(0x88e2ef003421a231),
+        UINT64_C(0x78562c820c8ec81f), UINT64_C(0x5ab921db3877acf3),
+        UINT64_C(0x3d883630657c01c7), UINT64_C(0x1f673b695185652b),
+        UINT64_C(0xf3ea19e6df6b5baf), UINT64_C(0xd10514bfeb923f43),
+        UINT64_C(0xb6340354b6999277), UINT64_C(0x94db0e0d8260f69b),
+        UINT64_C(0xfdf6e960044bf1fa), UINT64_C(0xdf19e43930b29516),
+        UINT64_C(0xb828f3d26db93822), UINT64_C(0x9ac7fe8b59405cce),
+        UINT64_C(0x764adc04d7ae624a), UINT64_C(0x54a5d15de35706a6),
+        UINT64_C(0x3394c6b6be5cab92), UINT64_C(0x117bcbef8aa5cf7e),
+        UINT64_C(0x4025ee99600c614b), UINT64_C(0x62cae3c054f505a7),
+        UINT64_C(0x05fbf42b09fea893), UINT64_C(0x2714f9723d07cc7f),
+        UINT64_C(0xcb99dbfdb3e9f2fb), UINT64_C(0xe976d6a487109617),
+        UINT64_C(0x8e47c14fda1b3b23), UINT64_C(0xaca8cc16eee25fcf),
+        UINT64_C(0xc5852b7b68c958ae), UINT64_C(0xe76a26225c303c42),
+        UINT64_C(0x805b31c9013b9176), UINT64_C(0xa2b43c9035c2f59a),
+        UINT64_C(0x4e391e1fbb2ccb1e), UINT64_C(0x6cd613468fd5aff2),
+        UINT64_C(0x0be704add2de02c6), UINT64_C(0x290809f4e627662a),
+        UINT64_C(0xd9bcca76de880c04), UINT64_C(0xfb53c72fea7168e8),
+        UINT64_C(0x9c62d0c4b77ac5dc), UINT64_C(0xbe8ddd9d8383a130),
+        UINT64_C(0x5200ff120d6d9fb4), UINT64_C(0x70eff24b3994fb58),
+        UINT64_C(0x17dee5a0649f566c), UINT64_C(0x3531e8f950663280),
+        UINT64_C(0x5c1c0f94d64d35e1), UINT64_C(0x7ef302cde2b4510d),
+        UINT64_C(0x19c21526bfbffc39), UINT64_C(0x3b2d187f8b4698d5),
+        UINT64_C(0xd7a03af005a8a651), UINT64_C(0xf54f37a93151c2bd),
+        UINT64_C(0x927e20426c5a6f89), UINT64_C(0xb0912d1b58a30b65)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xdabe95afc7875f40),
+        UINT64_C(0x27a584742000a005), UINT64_C(0xfd1b11dbe787ff45),
+        UINT64_C(0x4f4b08e84001400a), UINT64_C(0x95f59d4787861f4a),
+        UINT64_C(0x68ee8c9c6001e00f), UINT64_C(0xb2501933a786bf4f),
+        UINT64_C(0x9e9611d080028014), UINT64_C(0x4428847f4785df54),
+        UINT64_C(0xb93395a4a0022011), UINT64_C(0x638d000b67857f51),
+        UINT64_C(0xd1dd1938c003c01e), UINT64_C(0x0b638c9707849f5e),
+        UINT64_C(0xf6789d4ce003601b), UINT64_C(0x2cc608e327843f5b),
+        UINT64_C(0xaff48c8aaf0b1ead), UINT64_C(0x754a1925688c41ed),
+        UINT64_C(0x885108fe8f0bbea8), UINT64_C(0x52ef9d51488ce1e8),
+        UINT64_C(0xe0bf8462ef0a5ea7), UINT64_C(0x3a0111cd288d01e7),
+        UINT64_C(0xc71a0016cf0afea2), UINT64_C(0x1da495b9088da1e2),
+        UINT64_C(0x31629d5a2f099eb9), UINT64_C(0xebdc08f5e88ec1f9),
+        UINT64_C(0x16c7192e0f093ebc), UINT64_C(0xcc798c81c88e61fc),
+        UINT64_C(0x7e2995b26f08deb3), UINT64_C(0xa497001da88f81f3),
+        UINT64_C(0x598c11c64f087eb6), UINT64_C(0x83328469888f21f6),
+        UINT64_C(0xcd31b63ef11823df), UINT64_C(0x178f2391369f7c9f),
+        UINT64_C(0xea94324ad11883da), UINT64_C(0x302aa7e5169fdc9a),
+        UINT64_C(0x827abed6b11963d5), UINT64_C(0x58c42b79769e3c95),
+        UINT64_C(0xa5df3aa29119c3d0), UINT64_C(0x7f61af0d569e9c90),
+        UINT64_C(0x53a7a7ee711aa3cb), UINT64_C(0x89193241b69dfc8b),
+        UINT64_C(0x7402239a511a03ce), UINT64_C(0xaebcb635969d5c8e),
+        UINT64_C(0x1cecaf06311be3c1), UINT64_C(0xc6523aa9f69cbc81),
+        UINT64_C(0x3b492b72111b43c4), UINT64_C(0xe1f7beddd69c1c84),
+        UINT64_C(0x62c53ab45e133d72), UINT64_C(0xb87baf1b99946232),
+        UINT64_C(0x4560bec07e139d77), UINT64_C(0x9fde2b6fb994c237),
+        UINT64_C(0x2d8e325c1e127d78), UINT64_C(0xf730a7f3d9952238),
+        UINT64_C(0x0a2bb6283e12dd7d), UINT64_C(0xd0952387f995823d),
+        UINT64_C(0xfc532b64de11bd66), UINT64_C(0x26edbecb1996e226),
+        UINT64_C(0xdbf6af10fe111d63), UINT64_C(0x01483abf39964223),
+        UINT64_C(0xb318238c9e10fd6c), UINT64_C(0x69a6b6235997a22c),
+        UINT64_C(0x94bda7f8be105d69), UINT64_C(0x4e03325779970229),
+        UINT64_C(0x08bbc3564d3e593b), UINT64_C(0xd20556f98ab9067b),
+        UINT64_C(0x2f1e47226d3ef93e), UINT64_C(0xf5a0d28daab9a67e),
+        UINT64_C(0x47f0cbbe0d3f1931), UINT64_C(0x9d4e5e11cab84671),
+        UINT64_C(0x60554fca2d3fb934), UINT64_C(0xbaebda65eab8e674),
+        UINT64_C(0x962dd286cd3cd92f), UINT64_C(0x4c9347290abb866f),
+        UINT64_C(0xb18856f2ed3c792a), UINT64_C(0x6b36c35d2abb266a),
+        UINT64_C(0xd966da6e8d3d9925), UINT64_C(0x03d84fc14abac665),
+        UINT64_C(0xfec35e1aad3d3920), UINT64_C(0x247dcbb56aba6660),
+        UINT64_C(0xa74f4fdce2354796), UINT64_C(0x7df1da7325b218d6),
+        UINT64_C(0x80eacba8c235e793), UINT64_C(0x5a545e0705b2b8d3),
+        UINT64_C(0xe8044734a234079c), UINT64_C(0x32bad29b65b358dc),
+        UINT64_C(0xcfa1c3408234a799), UINT64_C(0x151f56ef45b3f8d9),
+        UINT64_C(0x39d95e0c6237c782), UINT64_C(0xe367cba3a5b098c2),
+        UINT64_C(0x1e7cda7842376787), UINT64_C(0xc4c24fd785b038c7),
+        UINT64_C(0x769256e422368788), UINT64_C(0xac2cc34be5b1d8c8),
+        UINT64_C(0x5137d2900236278d), UINT64_C(0x8b89473fc5b178cd),
+        UINT64_C(0xc58a7568bc267ae4), UINT64_C(0x1f34e0c77ba125a4),
+        UINT64_C(0xe22ff11c9c26dae1), UINT64_C(0x389164b35ba185a1),
+        UINT64_C(0x8ac17d80fc273aee), UINT64_C(0x507fe82f3ba065ae),
+        UINT64_C(0xad64f9f4dc279aeb), UINT64_C(0x77da6c5b1ba0c5ab),
+        UINT64_C(0x5b1c64b83c24faf0), UINT64_C(0x81a2f117fba3a5b0),
+        UINT64_C(0x7cb9e0cc1c245af5), UINT64_C(0xa6077563dba305b5),
+        UINT64_C(0x14576c507c25bafa), UINT64_C(0xcee9f9ffbba2e5ba),
+        UINT64_C(0x33f2e8245c251aff), UINT64_C(0xe94c7d8b9ba245bf),
+        UINT64_C(0x6a7ef9e2132d6449), UINT64_C(0xb0c06c4dd4aa3b09),
+        UINT64_C(0x4ddb7d96332dc44c), UINT64_C(0x9765e839f4aa9b0c),
+        UINT64_C(0x2535f10a532c2443), UINT64_C(0xff8b64a594ab7b03),
+        UINT64_C(0x0290757e732c8446), UINT64_C(0xd82ee0d1b4abdb06),
+        UINT64_C(0xf4e8e832932fe45d), UINT64_C(0x2e567d9d54a8bb1d),
+        UINT64_C(0xd34d6c46b32f4458), UINT64_C(0x09f3f9e974a81b18),
+        UINT64_C(0xbba3e0dad32ea457), UINT64_C(0x611d757514a9fb17),
+        UINT64_C(0x9c0664aef32e0452), UINT64_C(0x46b8f10134a95b12),
+        UINT64_C(0x117786ac9a7cb276), UINT64_C(0xcbc913035dfbed36),
+        UINT64_C(0x36d202d8ba7c1273), UINT64_C(0xec6c97777dfb4d33),
+        UINT64_C(0x5e3c8e44da7df27c), UINT64_C(0x84821beb1dfaad3c),
+        UINT64_C(0x79990a30fa7d5279), UINT64_C(0xa3279f9f3dfa0d39),
+        UINT64_C(0x8fe1977c1a7e3262), UINT64_C(0x555f02d3ddf96d22),
+        UINT64_C(0xa84413083a7e9267), UINT64_C(0x72fa86a7fdf9cd27),
+        UINT64_C(0xc0aa9f945a7f7268), UINT64_C(0x1a140a3b9df82d28),
+        UINT64_C(0xe70f1be07a7fd26d), UINT64_C(0x3db18e4fbdf88d2d),
+        UINT64_C(0xbe830a263577acdb), UINT64_C(0x643d9f89f2f0f39b),
+        UINT64_C(0x99268e5215770cde), UINT64_C(0x43981bfdd2f0539e),
+        UINT64_C(0xf1c802ce7576ecd1), UINT64_C(0x2b769761b2f1b391),
+        UINT64_C(0xd66d86ba55764cd4), UINT64_C(0x0cd3131592f11394),
+        UINT64_C(0x20151bf6b5752ccf), UINT64_C(0xfaab8e5972f2738f),
+        UINT64_C(0x07b09f8295758cca), UINT64_C(0xdd0e0a2d52f2d38a),
+        UINT64_C(0x6f5e131ef5746cc5), UINT64_C(0xb5e086b132f33385),
+        UINT64_C(0x48fb976ad574ccc0), UINT64_C(0x924502c512f39380),
+        UINT64_C(0xdc4630926b6491a9), UINT64_C(0x06f8a53dace3cee9),
+        UINT64_C(0xfbe3b4e64b6431ac), UINT64_C(0x215d21498ce36eec),
+        UINT64_C(0x930d387a2b65d1a3), UINT64_C(0x49b3add5ece28ee3),
+        UINT64_C(0xb4a8bc0e0b6571a6), UINT64_C(0x6e1629a1cce22ee6),
+        UINT64_C(0x42d02142eb6611bd), UINT64_C(0x986eb4ed2ce14efd),
+        UINT64_C(0x6575a536cb66b1b8), UINT64_C(0xbfcb30990ce1eef8),
+        UINT64_C(0x0d9b29aaab6751b7), UINT64_C(0xd725bc056ce00ef7),
+        UINT64_C(0x2a3eadde8b67f1b2), UINT64_C(0xf08038714ce0aef2),
+        UINT64_C(0x73b2bc18c46f8f04), UINT64_C(0xa90c29b703e8d044),
+        UINT64_C(0x5417386ce46f2f01), UINT64_C(0x8ea9adc323e87041),
+        UINT64_C(0x3cf9b4f0846ecf0e), UINT64_C(0xe647215f43e9904e),
+        UINT64_C(0x1b5c3084a46e6f0b), UINT64_C(0xc1e2a52b63e9304b),
+        UINT64_C(0xed24adc8446d0f10), UINT64_C(0x379a386783ea5050),
+        UINT64_C(0xca8129bc646daf15), UINT64_C(0x103fbc13a3eaf055),
+        UINT64_C(0xa26fa520046c4f1a), UINT64_C(0x78d1308fc3eb105a),
+        UINT64_C(0x85ca2154246cef1f), UINT64_C(0x5f74b4fbe3ebb05f),
+        UINT64_C(0x19cc45fad742eb4d), UINT64_C(0xc372d05510c5b40d),
+        UINT64_C(0x3e69c18ef7424b48), UINT64_C(0xe4d7542130c51408),
+        UINT64_C(0x56874d129743ab47), UINT64_C(0x8c39d8bd50c4f407),
+        UINT64_C(0x7122c966b7430b42), UINT64_C(0xab9c5cc970c45402),
+        UINT64_C(0x875a542a57406b59), UINT64_C(0x5de4c18590c73419),
+        UINT64_C(0xa0ffd05e7740cb5c), UINT64_C(0x7a4145f1b0c7941c),
+        UINT64_C(0xc8115cc217412b53), UINT64_C(0x12afc96dd0c67413),
+        UINT64_C(0xefb4d8b637418b56), UINT64_C(0x350a4d19f0c6d416),
+        UINT64_C(0xb638c9707849f5e0), UINT64_C(0x6c865cdfbfceaaa0),
+        UINT64_C(0x919d4d04584955e5), UINT64_C(0x4b23d8ab9fce0aa5),
+        UINT64_C(0xf973c1983848b5ea), UINT64_C(0x23cd5437ffcfeaaa),
+        UINT64_C(0xded645ec184815ef), UINT64_C(0x0468d043dfcf4aaf),
+        UINT64_C(0x28aed8a0f84b75f4), UINT64_C(0xf2104d0f3fcc2ab4),
+        UINT64_C(0x0f0b5cd4d84bd5f1), UINT64_C(0xd5b5c97b1fcc8ab1),
+        UINT64_C(0x67e5d048b84a35fe), UINT64_C(0xbd5b45e77fcd6abe),
+        UINT64_C(0x4040543c984a95fb), UINT64_C(0x9afec1935fcdcabb),
+        UINT64_C(0xd4fdf3c4265ac892), UINT64_C(0x0e43666be1dd97d2),
+        UINT64_C(0xf35877b0065a6897), UINT64_C(0x29e6e21fc1dd37d7),
+        UINT64_C(0x9bb6fb2c665b8898), UINT64_C(0x41086e83a1dcd7d8),
+        UINT64_C(0xbc137f58465b289d), UINT64_C(0x66adeaf781dc77dd),
+        UINT64_C(0x4a6be214a6584886), UINT64_C(0x90d577bb61df17c6),
+        UINT64_C(0x6dce66608658e883), UINT64_C(0xb770f3cf41dfb7c3),
+        UINT64_C(0x0520eafce659088c), UINT64_C(0xdf9e7f5321de57cc),
+        UINT64_C(0x22856e88c659a889), UINT64_C(0xf83bfb2701def7c9),
+        UINT64_C(0x7b097f4e8951d63f), UINT64_C(0xa1b7eae14ed6897f),
+        UINT64_C(0x5cacfb3aa951763a), UINT64_C(0x86126e956ed6297a),
+        UINT64_C(0x344277a6c9509635), UINT64_C(0xeefce2090ed7c975),
+        UINT64_C(0x13e7f3d2e9503630), UINT64_C(0xc959667d2ed76970),
+        UINT64_C(0xe59f6e9e0953562b), UINT64_C(0x3f21fb31ced4096b),
+        UINT64_C(0xc23aeaea2953f62e), UINT64_C(0x18847f45eed4a96e),
+        UINT64_C(0xaad4667649521621), UINT64_C(0x706af3d98ed54961),
+        UINT64_C(0x8d71e2026952b624), UINT64_C(0x57cf77adaed5e964)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x646c955f440400fe),
+        UINT64_C(0xc8d92abe880801fc), UINT64_C(0xacb5bfe1cc0c0102),
+        UINT64_C(0x036afa56bf1e1d7d), UINT64_C(0x67066f09fb1a1d83),
+        UINT64_C(0xcbb3d0e837161c81), UINT64_C(0xafdf45b773121c7f),
+        UINT64_C(0x06d5f4ad7e3c3afa), UINT64_C(0x62b961f23a383a04),
+        UINT64_C(0xce0cde13f6343b06), UINT64_C(0xaa604b4cb2303bf8),
+        UINT64_C(0x05bf0efbc1222787), UINT64_C(0x61d39ba485262779),
+        UINT64_C(0xcd662445492a267b), UINT64_C(0xa90ab11a0d2e2685),
+        UINT64_C(0x0dabe95afc7875f4), UINT64_C(0x69c77c05b87c750a),
+        UINT64_C(0xc572c3e474707408), UINT64_C(0xa11e56bb307474f6),
+        UINT64_C(0x0ec1130c43666889), UINT64_C(0x6aad865307626877),
+        UINT64_C(0xc61839b2cb6e6975), UINT64_C(0xa274aced8f6a698b),
+        UINT64_C(0x0b7e1df782444f0e), UINT64_C(0x6f1288a8c6404ff0),
+        UINT64_C(0xc3a737490a4c4ef2), UINT64_C(0xa7cba2164e484e0c),
+        UINT64_C(0x0814e7a13d5a5273), UINT64_C(0x6c7872fe795e528d),
+        UINT64_C(0xc0cdcd1fb552538f), UINT64_C(0xa4a15840f1565371),
+        UINT64_C(0x1b57d2b5f8f0ebe8), UINT64_C(0x7f3b47eabcf4eb16),
+        UINT64_C(0xd38ef80b70f8ea14), UINT64_C(0xb7e26d5434fceaea),
+        UINT64_C(0x183d28e347eef695), UINT64_C(0x7c51bdbc03eaf66b),
+        UINT64_C(0xd0e4025dcfe6f769), UINT64_C(0xb48897028be2f797),
+        UINT64_C(0x1d82261886ccd112), UINT64_C(0x79eeb347c2c8d1ec),
+        UINT64_C(0xd55b0ca60ec4d0ee), UINT64_C(0xb13799f94ac0d010),
+        UINT64_C(0x1ee8dc4e39d2cc6f), UINT64_C(0x7a8449117dd6cc91),
+        UINT64_C(0xd631f6f0b1dacd93), UINT64_C(0xb25d63aff5decd6d),
+        UINT64_C(0x16fc3bef04889e1c), UINT64_C(0x7290aeb0408c9ee2),
+        UINT64_C(0xde2511518c809fe0), UINT64_C(0xba49840ec8849f1e),
+        UINT64_C(0x1596c1b9bb968361), UINT64_C(0x71fa54e6ff92839f),
+        UINT64_C(0xdd4feb07339e829d), UINT64_C(0xb9237e58779a8263),
+        UINT64_C(0x1029cf427ab4a4e6), UINT64_C(0x74455a1d3eb0a418),
+        UINT64_C(0xd8f0e5fcf2bca51a), UINT64_C(0xbc9c70a3b6b8a5e4),
+        UINT64_C(0x13433514c5aab99b), UINT64_C(0x772fa04b81aeb965),
+        UINT64_C(0xdb9a1faa4da2b867), UINT64_C(0xbff68af509a6b899),
+        UINT64_C(0x36afa56bf1e1d7d0), UINT64_C(0x52c33034b5e5d72e),
+        UINT64_C(0xfe768fd579e9d62c), UINT64_C(0x9a1a1a8a3dedd6d2),
+        UINT64_C(0x35c55f3d4effcaad), UINT64_C(0x51a9ca620afbca53),
+        UINT64_C(0xfd1c7583c6f7cb51), UINT64_C(0x9970e0dc82f3cbaf),
+        UINT64_C(0x307a51c68fdded2a), UINT64_C(0x5416c499cbd9edd4),
+        UINT64_C(0xf8a37b7807d5ecd6), UINT64_C(0x9ccfee2743d1ec28),
+        UINT64_C(0x3310ab9030c3f057), UINT64_C(0x577c3ecf74c7f0a9),
+        UINT64_C(0xfbc9812eb8cbf1ab), UINT64_C(0x9fa51471fccff155),
+        UINT64_C(0x3b044c310d99a224), UINT64_C(0x5f68d96e499da2da),
+        UINT64_C(0xf3dd668f8591a3d8), UINT64_C(0x97b1f3d0c195a326),
+        UINT64_C(0x386eb667b287bf59), UINT64_C(0x5c022338f683bfa7),
+        UINT64_C(0xf0b79cd93a8fbea5), UINT64_C(0x94db09867e8bbe5b),
+        UINT64_C(0x3dd1b89c73a598de), UINT64_C(0x59bd2dc337a19820),
+        UINT64_C(0xf5089222fbad9922), UINT64_C(0x9164077dbfa999dc),
+        UINT64_C(0x3ebb42caccbb85a3), UINT64_C(0x5ad7d79588bf855d),
+        UINT64_C(0xf662687444b3845f), UINT64_C(0x920efd2b00b784a1),
+        UINT64_C(0x2df877de09113c38), UINT64_C(0x4994e2814d153cc6),
+        UINT64_C(0xe5215d6081193dc4), UINT64_C(0x814dc83fc51d3d3a),
+        UINT64_C(0x2e928d88b60f2145), UINT64_C(0x4afe18d7f20b21bb),
+        UINT64_C(0xe64ba7363e0720b9), UINT64_C(0x822732697a032047),
+        UINT64_C(0x2b2d8373772d06c2), UINT64_C(0x4f41162c3329063c),
+        UINT64_C(0xe3f4a9cdff25073e), UINT64_C(0x87983c92bb2107c0),
+        UINT64_C(0x28477925c8331bbf), UINT64_C(0x4c2bec7a8c371b41),
+        UINT64_C(0xe09e539b403b1a43), UINT64_C(0x84f2c6c4043f1abd),
+        UINT64_C(0x20539e84f56949cc), UINT64_C(0x443f0bdbb16d4932),
+        UINT64_C(0xe88ab43a7d614830), UINT64_C(0x8ce62165396548ce),
+        UINT64_C(0x233964d24a7754b1), UINT64_C(0x4755f18d0e73544f),
+        UINT64_C(0xebe04e6cc27f554d), UINT64_C(0x8f8cdb33867b55b3),
+        UINT64_C(0x26866a298b557336), UINT64_C(0x42eaff76cf5173c8),
+        UINT64_C(0xee5f4097035d72ca), UINT64_C(0x8a33d5c847597234),
+        UINT64_C(0x25ec907f344b6e4b), UINT64_C(0x41800520704f6eb5),
+        UINT64_C(0xed35bac1bc436fb7), UINT64_C(0x89592f9ef8476f49),
+        UINT64_C(0x6d5f4ad7e3c3afa0), UINT64_C(0x0933df88a7c7af5e),
+        UINT64_C(0xa58660696bcbae5c), UINT64_C(0xc1eaf5362fcfaea2),
+        UINT64_C(0x6e35b0815cddb2dd), UINT64_C(0x0a5925de18d9b223),
+        UINT64_C(0xa6ec9a3fd4d5b321), UINT64_C(0xc2800f6090d1b3df),
+        UINT64_C(0x6b8abe7a9dff955a), UINT64_C(0x0fe62b25d9fb95a4),
+        UINT64_C(0xa35394c415f794a6), UINT64_C(0xc73f019b51f39458),
+        UINT64_C(0x68e0442c22e18827), UINT64_C(0x0c8cd17366e588d9),
+        UINT64_C(0xa0396e92aae989db), UINT64_C(0xc455fbcdeeed8925),
+        UINT64_C(0x60f4a38d1fbbda54), UINT64_C(0x049836d25bbfdaaa),
+        UINT64_C(0xa82d893397b3dba8), UINT64_C(0xcc411c6cd3b7db56),
+        UINT64_C(0x639e59dba0a5c729), UINT64_C(0x07f2cc84e4a1c7d7),
+        UINT64_C(0xab47736528adc6d5), UINT64_C(0xcf2be63a6ca9c62b),
+        UINT64_C(0x662157206187e0ae), UINT64_C(0x024dc27f2583e050),
+        UINT64_C(0xaef87d9ee98fe152), UINT64_C(0xca94e8c1ad8be1ac),
+        UINT64_C(0x654bad76de99fdd3), UINT64_C(0x012738299a9dfd2d),
+        UINT64_C(0xad9287c85691fc2f), UINT64_C(0xc9fe12971295fcd1),
+        UINT64_C(0x760898621b334448), UINT64_C(0x12640d3d5f3744b6),
+        UINT64_C(0xbed1b2dc933b45b4), UINT64_C(0xdabd2783d73f454a),
+        UINT64_C(0x75626234a42d5935), UINT64_C(0x110ef76be02959cb),
+        UINT64_C(0xbdbb488a2c2558c9), UINT64_C(0xd9d7ddd568215837),
+        UINT64_C(0x70dd6ccf650f7eb2), UINT64_C(0x14b1f990210b7e4c),
+        UINT64_C(0xb8044671ed077f4e), UINT64_C(0xdc68d32ea9037fb0),
+        UINT64_C(0x73b79699da1163cf), UINT64_C(0x17db03c69e156331),
+        UINT64_C(0xbb6ebc2752196233), UINT64_C(0xdf022978161d62cd),
+        UINT64_C(0x7ba37138e74b31bc), UINT64_C(0x1fcfe467a34f3142),
+        UINT64_C(0xb37a5b866f433040), UINT64_C(0xd716ced92b4730be),
+        UINT64_C(0x78c98b6e58552cc1), UINT64_C(0x1ca51e311c512c3f),
+        UINT64_C(0xb010a1d0d05d2d3d), UINT64_C(0xd47c348f94592dc3),
+        UINT64_C(0x7d76859599770b46), UINT64_C(0x191a10cadd730bb8),
+        UINT64_C(0xb5afaf2b117f0aba), UINT64_C(0xd1c33a74557b0a44),
+        UINT64_C(0x7e1c7fc32669163b), UINT64_C(0x1a70ea9c626d16c5),
+        UINT64_C(0xb6c5557dae6117c7), UINT64_C(0xd2a9c022ea651739),
+        UINT64_C(0x5bf0efbc12227870), UINT64_C(0x3f9c7ae35626788e),
+        UINT64_C(0x9329c5029a2a798c), UINT64_C(0xf745505dde2e7972),
+        UINT64_C(0x589a15eaad3c650d), UINT64_C(0x3cf680b5e93865f3),
+        UINT64_C(0x90433f54253464f1), UINT64_C(0xf42faa0b6130640f),
+        UINT64_C(0x5d251b116c1e428a), UINT64_C(0x39498e4e281a4274),
+        UINT64_C(0x95fc31afe4164376), UINT64_C(0xf190a4f0a0124388),
+        UINT64_C(0x5e4fe147d3005ff7), UINT64_C(0x3a23741897045f09),
+        UINT64_C(0x9696cbf95b085e0b), UINT64_C(0xf2fa5ea61f0c5ef5),
+        UINT64_C(0x565b06e6ee5a0d84), UINT64_C(0x323793b9aa5e0d7a),
+        UINT64_C(0x9e822c5866520c78), UINT64_C(0xfaeeb90722560c86),
+        UINT64_C(0x5531fcb0514410f9), UINT64_C(0x315d69ef15401007),
+        UINT64_C(0x9de8d60ed94c1105), UINT64_C(0xf98443519d4811fb),
+        UINT64_C(0x508ef24b9066377e), UINT64_C(0x34e26714d4623780),
+        UINT64_C(0x9857d8f5186e3682), UINT64_C(0xfc3b4daa5c6a367c),
+        UINT64_C(0x53e4081d2f782a03), UINT64_C(0x37889d426b7c2afd),
+        UINT64_C(0x9b3d22a3a7702bff), UINT64_C(0xff51b7fce3742b01),
+        UINT64_C(0x40a73d09ead29398), UINT64_C(0x24cba856aed69366),
+        UINT64_C(0x887e17b762da9264), UINT64_C(0xec1282e826de929a),
+        UINT64_C(0x43cdc75f55cc8ee5), UINT64_C(0x27a1520011c88e1b),
+        UINT64_C(0x8b14ede1ddc48f19), UINT64_C(0xef7878be99c08fe7),
+        UINT64_C(0x4672c9a494eea962), UINT64_C(0x221e5cfbd0eaa99c),
+        UINT64_C(0x8eabe31a1ce6a89e), UINT64_C(0xeac7764558e2a860),
+        UINT64_C(0x451833f22bf0b41f), UINT64_C(0x2174a6ad6ff4b4e1),
+        UINT64_C(0x8dc1194ca3f8b5e3), UINT64_C(0xe9ad8c13e7fcb51d),
+        UINT64_C(0x4d0cd45316aae66c), UINT64_C(0x2960410c52aee692),
+        UINT64_C(0x85d5feed9ea2e790), UINT64_C(0xe1b96bb2daa6e76e),
+        UINT64_C(0x4e662e05a9b4fb11), UINT64_C(0x2a0abb5aedb0fbef),
+        UINT64_C(0x86bf04bb21bcfaed), UINT64_C(0xe2d391e465b8fa13),
+        UINT64_C(0x4bd920fe6896dc96), UINT64_C(0x2fb5b5a12c92dc68),
+        UINT64_C(0x83000a40e09edd6a), UINT64_C(0xe76c9f1fa49add94),
+        UINT64_C(0x48b3daa8d788c1eb), UINT64_C(0x2cdf4ff7938cc115),
+        UINT64_C(0x806af0165f80c017), UINT64_C(0xe40665491b84c0e9)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x53e7815838846436),
+        UINT64_C(0xa7cf02b07108c86c), UINT64_C(0xf42883e8498cac5a),
+        UINT64_C(0xdd46aa4b4d1f8e5d), UINT64_C(0x8ea12b13759bea6b),
+        UINT64_C(0x7a89a8fb3c174631), UINT64_C(0x296e29a304932207),
+        UINT64_C(0x2855fbbd3531023f), UINT64_C(0x7bb27ae50db56609),
+        UINT64_C(0x8f9af90d4439ca53), UINT64_C(0xdc7d78557cbdae65),
+        UINT64_C(0xf51351f6782e8c62), UINT64_C(0xa6f4d0ae40aae854),
+        UINT64_C(0x52dc53460926440e), UINT64_C(0x013bd21e31a22038),
+        UINT64_C(0x50abf77a6a62047e), UINT64_C(0x034c762252e66048),
+        UINT64_C(0xf764f5ca1b6acc12), UINT64_C(0xa483749223eea824),
+        UINT64_C(0x8ded5d31277d8a23), UINT64_C(0xde0adc691ff9ee15),
+        UINT64_C(0x2a225f815675424f), UINT64_C(0x79c5ded96ef12679),
+        UINT64_C(0x78fe0cc75f530641), UINT64_C(0x2b198d9f67d76277),
+        UINT64_C(0xdf310e772e5bce2d), UINT64_C(0x8cd68f2f16dfaa1b),
+        UINT64_C(0xa5b8a68c124c881c), UINT64_C(0xf65f27d42ac8ec2a),
+        UINT64_C(0x0277a43c63444070), UINT64_C(0x519025645bc02446),
+        UINT64_C(0xa157eef4d4c408fc), UINT64_C(0xf2b06facec406cca),
+        UINT64_C(0x0698ec44a5ccc090), UINT64_C(0x557f6d1c9d48a4a6),
+        UINT64_C(0x7c1144bf99db86a1), UINT64_C(0x2ff6c5e7a15fe297),
+        UINT64_C(0xdbde460fe8d34ecd), UINT64_C(0x8839c757d0572afb),
+        UINT64_C(0x89021549e1f50ac3), UINT64_C(0xdae59411d9716ef5),
+        UINT64_C(0x2ecd17f990fdc2af), UINT64_C(0x7d2a96a1a879a699),
+        UINT64_C(0x5444bf02acea849e), UINT64_C(0x07a33e5a946ee0a8),
+        UINT64_C(0xf38bbdb2dde24cf2), UINT64_C(0xa06c3ceae56628c4),
+        UINT64_C(0xf1fc198ebea60c82), UINT64_C(0xa21b98d6862268b4),
+        UINT64_C(0x56331b3ecfaec4ee), UINT64_C(0x05d49a66f72aa0d8),
+        UINT64_C(0x2cbab3c5f3b982df), UINT64_C(0x7f5d329dcb3de6e9),
+        UINT64_C(0x8b75b17582b14ab3), UINT64_C(0xd892302dba352e85),
+        UINT64_C(0xd9a9e2338b970ebd), UINT64_C(0x8a4e636bb3136a8b),
+        UINT64_C(0x7e66e083fa9fc6d1), UINT64_C(0x2d8161dbc21ba2e7),
+        UINT64_C(0x04ef4878c68880e0), UINT64_C(0x5708c920fe0ce4d6),
+        UINT64_C(0xa3204ac8b780488c), UINT64_C(0xf0c7cb908f042cba),
+        UINT64_C(0xd07772c206860f7d), UINT64_C(0x8390f39a3e026b4b),
+        UINT64_C(0x77b87072778ec711), UINT64_C(0x245ff12a4f0aa327),
+        UINT64_C(0x0d31d8894b998120), UINT64_C(0x5ed659d1731de516),
+        UINT64_C(0xaafeda393a91494c), UINT64_C(0xf9195b6102152d7a),
+        UINT64_C(0xf822897f33b70d42), UINT64_C(0xabc508270b336974),
+        UINT64_C(0x5fed8bcf42bfc52e), UINT64_C(0x0c0a0a977a3ba118),
+        UINT64_C(0x256423347ea8831f), UINT64_C(0x7683a26c462ce729),
+        UINT64_C(0x82ab21840fa04b73), UINT64_C(0xd14ca0dc37242f45),
+        UINT64_C(0x80dc85b86ce40b03), UINT64_C(0xd33b04e054606f35),
+        UINT64_C(0x271387081decc36f), UINT64_C(0x74f406502568a759),
+        UINT64_C(0x5d9a2ff321fb855e), UINT64_C(0x0e7daeab197fe168),
+        UINT64_C(0xfa552d4350f34d32), UINT64_C(0xa9b2ac1b68772904),
+        UINT64_C(0xa8897e0559d5093c), UINT64_C(0xfb6eff5d61516d0a),
+        UINT64_C(0x0f467cb528ddc150), UINT64_C(0x5ca1fded1059a566),
+        UINT64_C(0x75cfd44e14ca8761), UINT64_C(0x262855162c4ee357),
+        UINT64_C(0xd200d6fe65c24f0d), UINT64_C(0x81e757a65d462b3b),
+        UINT64_C(0x71209c36d2420781), UINT64_C(0x22c71d6eeac663b7),
+        UINT64_C(0xd6ef9e86a34acfed), UINT64_C(0x85081fde9bceabdb),
+        UINT64_C(0xac66367d9f5d89dc), UINT64_C(0xff81b725a7d9edea),
+        UINT64_C(0x0ba934cdee5541b0), UINT64_C(0x584eb595d6d12586),
+        UINT64_C(0x5975678be77305be), UINT64_C(0x0a92e6d3dff76188),
+        UINT64_C(0xfeba653b967bcdd2), UINT64_C(0xad5de463aeffa9e4),
+        UINT64_C(0x8433cdc0aa6c8be3), UINT64_C(0xd7d44c9892e8efd5),
+        UINT64_C(0x23fccf70db64438f), UINT64_C(0x701b4e28e3e027b9),
+        UINT64_C(0x218b6b4cb82003ff), UINT64_C(0x726cea1480a467c9),
+        UINT64_C(0x864469fcc928cb93), UINT64_C(0xd5a3e8a4f1acafa5),
+        UINT64_C(0xfccdc107f53f8da2), UINT64_C(0xaf2a405fcdbbe994),
+        UINT64_C(0x5b02c3b7843745ce), UINT64_C(0x08e542efbcb321f8),
+        UINT64_C(0x09de90f18d1101c0), UINT64_C(0x5a3911a9b59565f6),
+        UINT64_C(0xae119241fc19c9ac), UINT64_C(0xfdf61319c49dad9a),
+        UINT64_C(0xd4983abac00e8f9d), UINT64_C(0x877fbbe2f88aebab),
+        UINT64_C(0x7357380ab10647f1), UINT64_C(0x20b0b952898223c7),
+        UINT64_C(0x32364aafa202007f), UINT64_C(0x61d1cbf79a866449),
+        UINT64_C(0x95f9481fd30ac813), UINT64_C(0xc61ec947eb8eac25),
+        UINT64_C(0xef70e0e4ef1d8e22), UINT64_C(0xbc9761bcd799ea14),
+        UINT64_C(0x48bfe2549e15464e), UINT64_C(0x1b58630ca6912278),
+        UINT64_C(0x1a63b11297330240), UINT64_C(0x4984304aafb76676),
+        UINT64_C(0xbdacb3a2e63bca2c), UINT64_C(0xee4b32fadebfae1a),
+        UINT64_C(0xc7251b59da2c8c1d), UINT64_C(0x94c29a01e2a8e82b),
+        UINT64_C(0x60ea19e9ab244471), UINT64_C(0x330d98b193a02047),
+        UINT64_C(0x629dbdd5c8600401), UINT64_C(0x317a3c8df0e46037),
+        UINT64_C(0xc552bf65b968cc6d), UINT64_C(0x96b53e3d81eca85b),
+        UINT64_C(0xbfdb179e857f8a5c), UINT64_C(0xec3c96c6bdfbee6a),
+        UINT64_C(0x1814152ef4774230), UINT64_C(0x4bf39476ccf32606),
+        UINT64_C(0x4ac84668fd51063e), UINT64_C(0x192fc730c5d56208),
+        UINT64_C(0xed0744d88c59ce52), UINT64_C(0xbee0c580b4ddaa64),
+        UINT64_C(0x978eec23b04e8863), UINT64_C(0xc4696d7b88caec55),
+        UINT64_C(0x3041ee93c146400f), UINT64_C(0x63a66fcbf9c22439),
+        UINT64_C(0x9361a45b76c60883), UINT64_C(0xc08625034e426cb5),
+        UINT64_C(0x34aea6eb07cec0ef), UINT64_C(0x674927b33f4aa4d9),
+        UINT64_C(0x4e270e103bd986de), UINT64_C(0x1dc08f48035de2e8),
+        UINT64_C(0xe9e80ca04ad14eb2), UINT64_C(0xba0f8df872552a84),
+        UINT64_C(0xbb345fe643f70abc), UINT64_C(0xe8d3debe7b736e8a),
+        UINT64_C(0x1cfb5d5632ffc2d0), UINT64_C(0x4f1cdc0e0a7ba6e6),
+        UINT64_C(0x6672f5ad0ee884e1), UINT64_C(0x359574f5366ce0d7),
+        UINT64_C(0xc1bdf71d7fe04c8d), UINT64_C(0x925a7645476428bb),
+        UINT64_C(0xc3ca53211ca40cfd), UINT64_C(0x902dd279242068cb),
+        UINT64_C(0x640551916dacc491), UINT64_C(0x37e2d0c95528a0a7),
+        UINT64_C(0x1e8cf96a51bb82a0), UINT64_C(0x4d6b7832693fe696),
+        UINT64_C(0xb943fbda20b34acc), UINT64_C(0xeaa47a8218372efa),
+        UINT64_C(0xeb9fa89c29950ec2), UINT64_C(0xb87829c411116af4),
+        UINT64_C(0x4c50aa2c589dc6ae), UINT64_C(0x1fb72b746019a298),
+        UINT64_C(0x36d902d7648a809f), UINT64_C(0x653e838f5c0ee4a9),
+        UINT64_C(0x91160067158248f3), UINT64_C(0xc2f1813f2d062cc5),
+        UINT64_C(0xe241386da4840f02), UINT64_C(0xb1a6b9359c006b34),
+        UINT64_C(0x458e3addd58cc76e), UINT64_C(0x1669bb85ed08a358),
+        UINT64_C(0x3f079226e99b815f), UINT64_C(0x6ce0137ed11fe569),
+        UINT64_C(0x98c8909698934933), UINT64_C(0xcb2f11cea0172d05),
+        UINT64_C(0xca14c3d091b50d3d), UINT64_C(0x99f34288a931690b),
+        UINT64_C(0x6ddbc160e0bdc551), UINT64_C(0x3e3c4038d839a167),
+        UINT64_C(0x1752699bdcaa8360), UINT64_C(0x44b5e8c3e42ee756),
+        UINT64_C(0xb09d6b2bada24b0c), UINT64_C(0xe37aea7395262f3a),
+        UINT64_C(0xb2eacf17cee60b7c), UINT64_C(0xe10d4e4ff6626f4a),
+        UINT64_C(0x1525cda7bfeec310), UINT64_C(0x46c24cff876aa726),
+        UINT64_C(0x6fac655c83f98521), UINT64_C(0x3c4be404bb7de117),
+        UINT64_C(0xc86367ecf2f14d4d), UINT64_C(0x9b84e6b4ca75297b),
+        UINT64_C(0x9abf34aafbd70943), UINT64_C(0xc958b5f2c3536d75),
+        UINT64_C(0x3d70361a8adfc12f), UINT64_C(0x6e97b742b25ba519),
+        UINT64_C(0x47f99ee1b6c8871e), UINT64_C(0x141e1fb98e4ce328),
+        UINT64_C(0xe0369c51c7c04f72), UINT64_C(0xb3d11d09ff442b44),
+        UINT64_C(0x4316d699704007fe), UINT64_C(0x10f157c148c463c8),
+        UINT64_C(0xe4d9d4290148cf92), UINT64_C(0xb73e557139ccaba4),
+        UINT64_C(0x9e507cd23d5f89a3), UINT64_C(0xcdb7fd8a05dbed95),
+        UINT64_C(0x399f7e624c5741cf), UINT64_C(0x6a78ff3a74d325f9),
+        UINT64_C(0x6b432d24457105c1), UINT64_C(0x38a4ac7c7df561f7),
+        UINT64_C(0xcc8c2f943479cdad), UINT64_C(0x9f6baecc0cfda99b),
+        UINT64_C(0xb605876f086e8b9c), UINT64_C(0xe5e2063730eaefaa),
+        UINT64_C(0x11ca85df796643f0), UINT64_C(0x422d048741e227c6),
+        UINT64_C(0x13bd21e31a220380), UINT64_C(0x405aa0bb22a667b6),
+        UINT64_C(0xb47223536b2acbec), UINT64_C(0xe795a20b53aeafda),
+        UINT64_C(0xcefb8ba8573d8ddd), UINT64_C(0x9d1c0af06fb9e9eb),
+        UINT64_C(0x69348918263545b1), UINT64_C(0x3ad308401eb12187),
+        UINT64_C(0x3be8da5e2f1301bf), UINT64_C(0x680f5b0617976589),
+        UINT64_C(0x9c27d8ee5e1bc9d3), UINT64_C(0xcfc059b6669fade5),
+        UINT64_C(0xe6ae7015620c8fe2), UINT64_C(0xb549f14d5a88ebd4),
+        UINT64_C(0x416172a51304478e), UINT64_C(0x1286f3fd2b8023b8)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x09abf11afca2d0d7),
+        UINT64_C(0x1357e235f945a1ae), UINT64_C(0x1afc132f05e77179),
+        UINT64_C(0x26afc46bf28b435c), UINT64_C(0x2f0435710e29938b),
+        UINT64_C(0x35f8265e0bcee2f2), UINT64_C(0x3c53d744f76c3225),
+        UINT64_C(0x4d5f88d7e51686b8), UINT64_C(0x44f479cd19b4566f),
+        UINT64_C(0x5e086ae21c532716), UINT64_C(0x57a39bf8e0f1f7c1),
+        UINT64_C(0x6bf04cbc179dc5e4), UINT64_C(0x625bbda6eb3f1533),
+        UINT64_C(0x78a7ae89eed8644a), UINT64_C(0x710c5f93127ab49d),
+        UINT64_C(0x9abf11afca2d0d70), UINT64_C(0x9314e0b5368fdda7),
+        UINT64_C(0x89e8f39a3368acde), UINT64_C(0x80430280cfca7c09),
+        UINT64_C(0xbc10d5c438a64e2c), UINT64_C(0xb5bb24dec4049efb),
+        UINT64_C(0xaf4737f1c1e3ef82), UINT64_C(0xa6ecc6eb3d413f55),
+        UINT64_C(0xd7e099782f3b8bc8), UINT64_C(0xde4b6862d3995b1f),
+        UINT64_C(0xc4b77b4dd67e2a66), UINT64_C(0xcd1c8a572adcfab1),
+        UINT64_C(0xf14f5d13ddb0c894), UINT64_C(0xf8e4ac0921121843),
+        UINT64_C(0xe218bf2624f5693a), UINT64_C(0xebb34e3cd857b9ed),
+        UINT64_C(0xa7a68c743b540465), UINT64_C(0xae0d7d6ec7f6d4b2),
+        UINT64_C(0xb4f16e41c211a5cb), UINT64_C(0xbd5a9f5b3eb3751c),
+        UINT64_C(0x8109481fc9df4739), UINT64_C(0x88a2b905357d97ee),
+        UINT64_C(0x925eaa2a309ae697), UINT64_C(0x9bf55b30cc383640),
+        UINT64_C(0xeaf904a3de4282dd), UINT64_C(0xe352f5b922e0520a),
+        UINT64_C(0xf9aee69627072373), UINT64_C(0xf005178cdba5f3a4),
+        UINT64_C(0xcc56c0c82cc9c181), UINT64_C(0xc5fd31d2d06b1156),
+        UINT64_C(0xdf0122fdd58c602f), UINT64_C(0xd6aad3e7292eb0f8),
+        UINT64_C(0x3d199ddbf1790915), UINT64_C(0x34b26cc10ddbd9c2),
+        UINT64_C(0x2e4e7fee083ca8bb), UINT64_C(0x27e58ef4f49e786c),
+        UINT64_C(0x1bb659b003f24a49), UINT64_C(0x121da8aaff509a9e),
+        UINT64_C(0x08e1bb85fab7ebe7), UINT64_C(0x014a4a9f06153b30),
+        UINT64_C(0x7046150c146f8fad), UINT64_C(0x79ede416e8cd5f7a),
+        UINT64_C(0x6311f739ed2a2e03), UINT64_C(0x6aba06231188fed4),
+        UINT64_C(0x56e9d167e6e4ccf1), UINT64_C(0x5f42207d1a461c26),
+        UINT64_C(0x45be33521fa16d5f), UINT64_C(0x4c15c248e303bd88),
+        UINT64_C(0xdd95b7c3d9a6164f), UINT64_C(0xd43e46d92504c698),
+        UINT64_C(0xcec255f620e3b7e1), UINT64_C(0xc769a4ecdc416736),
+        UINT64_C(0xfb3a73a82b2d5513), UINT64_C(0xf29182b2d78f85c4),
+        UINT64_C(0xe86d919dd268f4bd), UINT64_C(0xe1c660872eca246a),
+        UINT64_C(0x90ca3f143cb090f7), UINT64_C(0x9961ce0ec0124020),
+        UINT64_C(0x839ddd21c5f53159), UINT64_C(0x8a362c3b3957e18e),
+        UINT64_C(0xb665fb7fce3bd3ab), UINT64_C(0xbfce0a653299037c),
+        UINT64_C(0xa532194a377e7205), UINT64_C(0xac99e850cbdca2d2),
+        UINT64_C(0x472aa66c138b1b3f), UINT64_C(0x4e815776ef29cbe8),
+        UINT64_C(0x547d4459eaceba91), UINT64_C(0x5dd6b543166c6a46),
+        UINT64_C(0x61856207e1005863), UINT64_C(0x682e931d1da288b4),
+        UINT64_C(0x72d280321845f9cd), UINT64_C(0x7b797128e4e7291a),
+        UINT64_C(0x0a752ebbf69d9d87), UINT64_C(0x03dedfa10a3f4d50),
+        UINT64_C(0x1922cc8e0fd83c29), UINT64_C(0x10893d94f37aecfe),
+        UINT64_C(0x2cdaead00416dedb), UINT64_C(0x25711bcaf8b40e0c),
+        UINT64_C(0x3f8d08e5fd537f75), UINT64_C(0x3626f9ff01f1afa2),
+        UINT64_C(0x7a333bb7e2f2122a), UINT64_C(0x7398caad1e50c2fd),
+        UINT64_C(0x6964d9821bb7b384), UINT64_C(0x60cf2898e7156353),
+        UINT64_C(0x5c9cffdc10795176), UINT64_C(0x55370ec6ecdb81a1),
+        UINT64_C(0x4fcb1de9e93cf0d8), UINT64_C(0x4660ecf3159e200f),
+        UINT64_C(0x376cb36007e49492), UINT64_C(0x3ec7427afb464445),
+        UINT64_C(0x243b5155fea1353c), UINT64_C(0x2d90a04f0203e5eb),
+        UINT64_C(0x11c3770bf56fd7ce), UINT64_C(0x1868861109cd0719),
+        UINT64_C(0x0294953e0c2a7660), UINT64_C(0x0b3f6424f088a6b7),
+        UINT64_C(0xe08c2a1828df1f5a), UINT64_C(0xe927db02d47dcf8d),
+        UINT64_C(0xf3dbc82dd19abef4), UINT64_C(0xfa7039372d386e23),
+        UINT64_C(0xc623ee73da545c06), UINT64_C(0xcf881f6926f68cd1),
+        UINT64_C(0xd5740c462311fda8), UINT64_C(0xdcdffd5cdfb32d7f),
+        UINT64_C(0xadd3a2cfcdc999e2), UINT64_C(0xa47853d5316b4935),
+        UINT64_C(0xbe8440fa348c384c), UINT64_C(0xb72fb1e0c82ee89b),
+        UINT64_C(0x8b7c66a43f42dabe), UINT64_C(0x82d797bec3e00a69),
+        UINT64_C(0x982b8491c6077b10), UINT64_C(0x9180758b3aa5abc7),
+        UINT64_C(0x29f3c0ac1c42321b), UINT64_C(0x205831b6e0e0e2cc),
+        UINT64_C(0x3aa42299e50793b5), UINT64_C(0x330fd38319a54362),
+        UINT64_C(0x0f5c04c7eec97147), UINT64_C(0x06f7f5dd126ba190),
+        UINT64_C(0x1c0be6f2178cd0e9), UINT64_C(0x15a017e8eb2e003e),
+        UINT64_C(0x64ac487bf954b4a3), UINT64_C(0x6d07b96105f66474),
+        UINT64_C(0x77fbaa4e0011150d), UINT64_C(0x7e505b54fcb3c5da),
+        UINT64_C(0x42038c100bdff7ff), UINT64_C(0x4ba87d0af77d2728),
+        UINT64_C(0x51546e25f29a5651), UINT64_C(0x58ff9f3f0e388686),
+        UINT64_C(0xb34cd103d66f3f6b), UINT64_C(0xbae720192acdefbc),
+        UINT64_C(0xa01b33362f2a9ec5), UINT64_C(0xa9b0c22cd3884e12),
+        UINT64_C(0x95e3156824e47c37), UINT64_C(0x9c48e472d846ace0),
+        UINT64_C(0x86b4f75ddda1dd99), UINT64_C(0x8f1f064721030d4e),
+        UINT64_C(0xfe1359d43379b9d3), UINT64_C(0xf7b8a8cecfdb6904),
+        UINT64_C(0xed44bbe1ca3c187d), UINT64_C(0xe4ef4afb369ec8aa),
+        UINT64_C(0xd8bc9dbfc1f2fa8f), UINT64_C(0xd1176ca53d502a58),
+        UINT64_C(0xcbeb7f8a38b75b21), UINT64_C(0xc2408e90c4158bf6),
+        UINT64_C(0x8e554cd82716367e), UINT64_C(0x87febdc2dbb4e6a9),
+        UINT64_C(0x9d02aeedde5397d0), UINT64_C(0x94a95ff722f14707),
+        UINT64_C(0xa8fa88b3d59d7522), UINT64_C(0xa15179a9293fa5f5),
+        UINT64_C(0xbbad6a862cd8d48c), UINT64_C(0xb2069b9cd07a045b),
+        UINT64_C(0xc30ac40fc200b0c6), UINT64_C(0xcaa135153ea26011),
+        UINT64_C(0xd05d263a3b451168), UINT64_C(0xd9f6d720c7e7c1bf),
+        UINT64_C(0xe5a50064308bf39a), UINT64_C(0xec0ef17ecc29234d),
+        UINT64_C(0xf6f2e251c9ce5234), UINT64_C(0xff59134b356c82e3),
+        UINT64_C(0x14ea5d77ed3b3b0e), UINT64_C(0x1d41ac6d1199ebd9),
+        UINT64_C(0x07bdbf42147e9aa0), UINT64_C(0x0e164e58e8dc4a77),
+        UINT64_C(0x3245991c1fb07852), UINT64_C(0x3bee6806e312a885),
+        UINT64_C(0x21127b29e6f5d9fc), UINT64_C(0x28b98a331a57092b),
+        UINT64_C(0x59b5d5a0082dbdb6), UINT64_C(0x501e24baf48f6d61),
+        UINT64_C(0x4ae23795f1681c18), UINT64_C(0x4349c68f0dcacccf),
+        UINT64_C(0x7f1a11cbfaa6feea), UINT64_C(0x76b1e0d106042e3d),
+        UINT64_C(0x6c4df3fe03e35f44), UINT64_C(0x65e602e4ff418f93),
+        UINT64_C(0xf466776fc5e42454), UINT64_C(0xfdcd86753946f483),
+        UINT64_C(0xe731955a3ca185fa), UINT64_C(0xee9a6440c003552d),
+        UINT64_C(0xd2c9b304376f6708), UINT64_C(0xdb62421ecbcdb7df),
+        UINT64_C(0xc19e5131ce2ac6a6), UINT64_C(0xc835a02b32881671),
+        UINT64_C(0xb939ffb820f2a2ec), UINT64_C(0xb0920ea2dc50723b),
+        UINT64_C(0xaa6e1d8dd9b70342), UINT64_C(0xa3c5ec972515d395),
+        UINT64_C(0x9f963bd3d279e1b0), UINT64_C(0x963dcac92edb3167),
+        UINT64_C(0x8cc1d9e62b3c401e), UINT64_C(0x856a28fcd79e90c9),
+        UINT64_C(0x6ed966c00fc92924), UINT64_C(0x677297daf36bf9f3),
+        UINT64_C(0x7d8e84f5f68c888a), UINT64_C(0x742575ef0a2e585d),
+        UINT64_C(0x4876a2abfd426a78), UINT64_C(0x41dd53b101e0baaf),
+        UINT64_C(0x5b21409e0407cbd6), UINT64_C(0x528ab184f8a51b01),
+        UINT64_C(0x2386ee17eadfaf9c), UINT64_C(0x2a2d1f0d167d7f4b),
+        UINT64_C(0x30d10c22139a0e32), UINT64_C(0x397afd38ef38dee5),
+        UINT64_C(0x05292a7c1854ecc0), UINT64_C(0x0c82db66e4f63c17),
+        UINT64_C(0x167ec849e1114d6e), UINT64_C(0x1fd539531db39db9),
+        UINT64_C(0x53c0fb1bfeb02031), UINT64_C(0x5a6b0a010212f0e6),
+        UINT64_C(0x4097192e07f5819f), UINT64_C(0x493ce834fb575148),
+        UINT64_C(0x756f3f700c3b636d), UINT64_C(0x7cc4ce6af099b3ba),
+        UINT64_C(0x6638dd45f57ec2c3), UINT64_C(0x6f932c5f09dc1214),
+        UINT64_C(0x1e9f73cc1ba6a689), UINT64_C(0x173482d6e704765e),
+        UINT64_C(0x0dc891f9e2e30727), UINT64_C(0x046360e31e41d7f0),
+        UINT64_C(0x3830b7a7e92de5d5), UINT64_C(0x319b46bd158f3502),
+        UINT64_C(0x2b6755921068447b), UINT64_C(0x22cca488ecca94ac),
+        UINT64_C(0xc97feab4349d2d41), UINT64_C(0xc0d41baec83ffd96),
+        UINT64_C(0xda280881cdd88cef), UINT64_C(0xd383f99b317a5c38),
+        UINT64_C(0xefd02edfc6166e1d), UINT64_C(0xe67bdfc53ab4beca),
+        UINT64_C(0xfc87ccea3f53cfb3), UINT64_C(0xf52c3df0c3f11f64),
+        UINT64_C(0x84206263d18babf9), UINT64_C(0x8d8b93792d297b2e),
+        UINT64_C(0x9777805628ce0a57), UINT64_C(0x9edc714cd46cda80),
+        UINT64_C(0xa28fa6082300e8a5), UINT64_C(0xab245712dfa23872),
+        UINT64_C(0xb1d8443dda45490b), UINT64_C(0xb873b52726e799dc)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xec32cffb23e3ed7d),
+        UINT64_C(0x4abd30dde8c9c47f), UINT64_C(0xa68fff26cb2a2902),
+        UINT64_C(0x957a61bbd19388fe), UINT64_C(0x7948ae40f2706583),
+        UINT64_C(0xdfc75166395a4c81), UINT64_C(0x33f59e9d1ab9a1fc),
+        UINT64_C(0xb82c6c5c0c290f79), UINT64_C(0x541ea3a72fcae204),
+        UINT64_C(0xf2915c81e4e0cb06), UINT64_C(0x1ea3937ac703267b),
+        UINT64_C(0x2d560de7ddba8787), UINT64_C(0xc164c21cfe596afa),
+        UINT64_C(0x67eb3d3a357343f8), UINT64_C(0x8bd9f2c11690ae85),
+        UINT64_C(0xe2807793b75c0077), UINT64_C(0x0eb2b86894bfed0a),
+        UINT64_C(0xa83d474e5f95c408), UINT64_C(0x440f88b57c762975),
+        UINT64_C(0x77fa162866cf8889), UINT64_C(0x9bc8d9d3452c65f4),
+        UINT64_C(0x3d4726f58e064cf6), UINT64_C(0xd175e90eade5a18b),
+        UINT64_C(0x5aac1bcfbb750f0e), UINT64_C(0xb69ed4349896e273),
+        UINT64_C(0x10112b1253bccb71), UINT64_C(0xfc23e4e9705f260c),
+        UINT64_C(0xcfd67a746ae687f0), UINT64_C(0x23e4b58f49056a8d),
+        UINT64_C(0x856b4aa9822f438f), UINT64_C(0x69598552a1ccaef2),
+        UINT64_C(0x57d8400cc1b61e6b), UINT64_C(0xbbea8ff7e255f316),
+        UINT64_C(0x1d6570d1297fda14), UINT64_C(0xf157bf2a0a9c3769),
+        UINT64_C(0xc2a221b710259695), UINT64_C(0x2e90ee4c33c67be8),
+        UINT64_C(0x881f116af8ec52ea), UINT64_C(0x642dde91db0fbf97),
+        UINT64_C(0xeff42c50cd9f1112), UINT64_C(0x03c6e3abee7cfc6f),
+        UINT64_C(0xa5491c8d2556d56d), UINT64_C(0x497bd37606b53810),
+        UINT64_C(0x7a8e4deb1c0c99ec), UINT64_C(0x96bc82103fef7491),
+        UINT64_C(0x30337d36f4c55d93), UINT64_C(0xdc01b2cdd726b0ee),
+        UINT64_C(0xb558379f76ea1e1c), UINT64_C(0x596af8645509f361),
+        UINT64_C(0xffe507429e23da63), UINT64_C(0x13d7c8b9bdc0371e),
+        UINT64_C(0x20225624a77996e2), UINT64_C(0xcc1099df849a7b9f),
+        UINT64_C(0x6a9f66f94fb0529d), UINT64_C(0x86ada9026c53bfe0),
+        UINT64_C(0x0d745bc37ac31165), UINT64_C(0xe14694385920fc18),
+        UINT64_C(0x47c96b1e920ad51a), UINT64_C(0xabfba4e5b1e93867),
+        UINT64_C(0x980e3a78ab50999b), UINT64_C(0x743cf58388b374e6),
+        UINT64_C(0xd2b30aa543995de4), UINT64_C(0x3e81c55e607ab099),
+        UINT64_C(0xafb08019836c3cd6), UINT64_C(0x43824fe2a08fd1ab),
+        UINT64_C(0xe50db0c46ba5f8a9), UINT64_C(0x093f7f3f484615d4),
+        UINT64_C(0x3acae1a252ffb428), UINT64_C(0xd6f82e59711c5955),
+        UINT64_C(0x7077d17fba367057), UINT64_C(0x9c451e8499d59d2a),
+        UINT64_C(0x179cec458f4533af), UINT64_C(0xfbae23beaca6ded2),
+        UINT64_C(0x5d21dc98678cf7d0), UINT64_C(0xb1131363446f1aad),
+        UINT64_C(0x82e68dfe5ed6bb51), UINT64_C(0x6ed442057d35562c),
+        UINT64_C(0xc85bbd23b61f7f2e), UINT64_C(0x246972d895fc9253),
+        UINT64_C(0x4d30f78a34303ca1), UINT64_C(0xa102387117d3d1dc),
+        UINT64_C(0x078dc757dcf9f8de), UINT64_C(0xebbf08acff1a15a3),
+        UINT64_C(0xd84a9631e5a3b45f), UINT64_C(0x347859cac6405922),
+        UINT64_C(0x92f7a6ec0d6a7020), UINT64_C(0x7ec569172e899d5d),
+        UINT64_C(0xf51c9bd6381933d8), UINT64_C(0x192e542d1bfadea5),
+        UINT64_C(0xbfa1ab0bd0d0f7a7), UINT64_C(0x539364f0f3331ada),
+        UINT64_C(0x6066fa6de98abb26), UINT64_C(0x8c543596ca69565b),
+        UINT64_C(0x2adbcab001437f59), UINT64_C(0xc6e9054b22a09224),
+        UINT64_C(0xf868c01542da22bd), UINT64_C(0x145a0fee6139cfc0),
+        UINT64_C(0xb2d5f0c8aa13e6c2), UINT64_C(0x5ee73f3389f00bbf),
+        UINT64_C(0x6d12a1ae9349aa43), UINT64_C(0x81206e55b0aa473e),
+        UINT64_C(0x27af91737b806e3c), UINT64_C(0xcb9d5e8858638341),
+        UINT64_C(0x4044ac494ef32dc4), UINT64_C(0xac7663b26d10c0b9),
+        UINT64_C(0x0af99c94a63ae9bb), UINT64_C(0xe6cb536f85d904c6),
+        UINT64_C(0xd53ecdf29f60a53a), UINT64_C(0x390c0209bc834847),
+        UINT64_C(0x9f83fd2f77a96145), UINT64_C(0x73b132d4544a8c38),
+        UINT64_C(0x1ae8b786f58622ca), UINT64_C(0xf6da787dd665cfb7),
+        UINT64_C(0x5055875b1d4fe6b5), UINT64_C(0xbc6748a03eac0bc8),
+        UINT64_C(0x8f92d63d2415aa34), UINT64_C(0x63a019c607f64749),
+        UINT64_C(0xc52fe6e0ccdc6e4b), UINT64_C(0x291d291bef3f8336),
+        UINT64_C(0xa2c4dbdaf9af2db3), UINT64_C(0x4ef61421da4cc0ce),
+        UINT64_C(0xe879eb071166e9cc), UINT64_C(0x044b24fc328504b1),
+        UINT64_C(0x37beba61283ca54d), UINT64_C(0xdb8c759a0bdf4830),
+        UINT64_C(0x7d038abcc0f56132), UINT64_C(0x91314547e3168c4f),
+        UINT64_C(0xcdb9af18a9d66729), UINT64_C(0x218b60e38a358a54),
+        UINT64_C(0x87049fc5411fa356), UINT64_C(0x6b36503e62fc4e2b),
+        UINT64_C(0x58c3cea37845efd7), UINT64_C(0xb4f101585ba602aa),
+        UINT64_C(0x127efe7e908c2ba8), UINT64_C(0xfe4c3185b36fc6d5),
+        UINT64_C(0x7595c344a5ff6850), UINT64_C(0x99a70cbf861c852d),
+        UINT64_C(0x3f28f3994d36ac2f), UINT64_C(0xd31a3c626ed54152),
+        UINT64_C(0xe0efa2ff746ce0ae), UINT64_C(0x0cdd6d04578f0dd3),
+        UINT64_C(0xaa5292229ca524d1), UINT64_C(0x46605dd9bf46c9ac),
+        UINT64_C(0x2f39d88b1e8a675e), UINT64_C(0xc30b17703d698a23),
+        UINT64_C(0x6584e856f643a321), UINT64_C(0x89b627add5a04e5c),
+        UINT64_C(0xba43b930cf19efa0), UINT64_C(0x567176cbecfa02dd),
+        UINT64_C(0xf0fe89ed27d02bdf), UINT64_C(0x1ccc46160433c6a2),
+        UINT64_C(0x9715b4d712a36827), UINT64_C(0x7b277b2c3140855a),
+        UINT64_C(0xdda8840afa6aac58), UINT64_C(0x319a4bf1d9894125),
+        UINT64_C(0x026fd56cc330e0d9), UINT64_C(0xee5d1a97e0d30da4),
+        UINT64_C(0x48d2e5b12bf924a6), UINT64_C(0xa4e02a4a081ac9db),
+        UINT64_C(0x9a61ef1468607942), UINT64_C(0x765320ef4b83943f),
+        UINT64_C(0xd0dcdfc980a9bd3d), UINT64_C(0x3cee1032a34a5040),
+        UINT64_C(0x0f1b8eafb9f3f1bc), UINT64_C(0xe32941549a101cc1),
+        UINT64_C(0x45a6be72513a35c3), UINT64_C(0xa994718972d9d8be),
+        UINT64_C(0x224d83486449763b), UINT64_C(0xce7f4cb347aa9b46),
+        UINT64_C(0x68f0b3958c80b244), UINT64_C(0x84c27c6eaf635f39),
+        UINT64_C(0xb737e2f3b5dafec5), UINT64_C(0x5b052d08963913b8),
+        UINT64_C(0xfd8ad22e5d133aba), UINT64_C(0x11b81dd57ef0d7c7),
+        UINT64_C(0x78e19887df3c7935), UINT64_C(0x94d3577cfcdf9448),
+        UINT64_C(0x325ca85a37f5bd4a), UINT64_C(0xde6e67a114165037),
+        UINT64_C(0xed9bf93c0eaff1cb), UINT64_C(0x01a936c72d4c1cb6),
+        UINT64_C(0xa726c9e1e66635b4), UINT64_C(0x4b14061ac585d8c9),
+        UINT64_C(0xc0cdf4dbd315764c), UINT64_C(0x2cff3b20f0f69b31),
+        UINT64_C(0x8a70c4063bdcb233), UINT64_C(0x66420bfd183f5f4e),
+        UINT64_C(0x55b795600286feb2), UINT64_C(0xb9855a9b216513cf),
+        UINT64_C(0x1f0aa5bdea4f3acd), UINT64_C(0xf3386a46c9acd7b0),
+        UINT64_C(0x62092f012aba5bff), UINT64_C(0x8e3be0fa0959b682),
+        UINT64_C(0x28b41fdcc2739f80), UINT64_C(0xc486d027e19072fd),
+        UINT64_C(0xf7734ebafb29d301), UINT64_C(0x1b418141d8ca3e7c),
+        UINT64_C(0xbdce7e6713e0177e), UINT64_C(0x51fcb19c3003fa03),
+        UINT64_C(0xda25435d26935486), UINT64_C(0x36178ca60570b9fb),
+        UINT64_C(0x90987380ce5a90f9), UINT64_C(0x7caabc7bedb97d84),
+        UINT64_C(0x4f5f22e6f700dc78), UINT64_C(0xa36ded1dd4e33105),
+        UINT64_C(0x05e2123b1fc91807), UINT64_C(0xe9d0ddc03c2af57a),
+        UINT64_C(0x808958929de65b88), UINT64_C(0x6cbb9769be05b6f5),
+        UINT64_C(0xca34684f752f9ff7), UINT64_C(0x2606a7b456cc728a),
+        UINT64_C(0x15f339294c75d376), UINT64_C(0xf9c1f6d26f963e0b),
+        UINT64_C(0x5f4e09f4a4bc1709), UINT64_C(0xb37cc60f875ffa74),
+        UINT64_C(0x38a534ce91cf54f1), UINT64_C(0xd497fb35b22cb98c),
+        UINT64_C(0x721804137906908e), UINT64_C(0x9e2acbe85ae57df3),
+        UINT64_C(0xaddf5575405cdc0f), UINT64_C(0x41ed9a8e63bf3172),
+        UINT64_C(0xe76265a8a8951870), UINT64_C(0x0b50aa538b76f50d),
+        UINT64_C(0x35d16f0deb0c4594), UINT64_C(0xd9e3a0f6c8efa8e9),
+        UINT64_C(0x7f6c5fd003c581eb), UINT64_C(0x935e902b20266c96),
+        UINT64_C(0xa0ab0eb63a9fcd6a), UINT64_C(0x4c99c14d197c2017),
+        UINT64_C(0xea163e6bd2560915), UINT64_C(0x0624f190f1b5e468),
+        UINT64_C(0x8dfd0351e7254aed), UINT64_C(0x61cfccaac4c6a790),
+        UINT64_C(0xc740338c0fec8e92), UINT64_C(0x2b72fc772c0f63ef),
+        UINT64_C(0x188762ea36b6c213), UINT64_C(0xf4b5ad1115552f6e),
+        UINT64_C(0x523a5237de7f066c), UINT64_C(0xbe089dccfd9ceb11),
+        UINT64_C(0xd751189e5c5045e3), UINT64_C(0x3b63d7657fb3a89e),
+        UINT64_C(0x9dec2843b499819c), UINT64_C(0x71dee7b8977a6ce1),
+        UINT64_C(0x422b79258dc3cd1d), UINT64_C(0xae19b6deae202060),
+        UINT64_C(0x089649f8650a0962), UINT64_C(0xe4a4860346e9e41f),
+        UINT64_C(0x6f7d74c250794a9a), UINT64_C(0x834fbb39739aa7e7),
+        UINT64_C(0x25c0441fb8b08ee5), UINT64_C(0xc9f28be49b536398),
+        UINT64_C(0xfa07157981eac264), UINT64_C(0x1635da82a2092f19),
+        UINT64_C(0xb0ba25a46923061b), UINT64_C(0x5c88ea5f4ac0eb66)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xdda9f27ee08373ad),
+        UINT64_C(0x298b4bd66e08f9df), UINT64_C(0xf422b9a88e8b8a72),
+        UINT64_C(0x531697acdc11f3be), UINT64_C(0x8ebf65d23c928013),
+        UINT64_C(0x7a9ddc7ab2190a61), UINT64_C(0xa7342e04529a79cc),
+        UINT64_C(0xa62d2f59b823e77c), UINT64_C(0x7b84dd2758a094d1),
+        UINT64_C(0x8fa6648fd62b1ea3), UINT64_C(0x520f96f136a86d0e),
+        UINT64_C(0xf53bb8f5643214c2), UINT64_C(0x28924a8b84b1676f),
+        UINT64_C(0xdcb0f3230a3aed1d), UINT64_C(0x0119015deab99eb0),
+        UINT64_C(0xde82f198df49d07d), UINT64_C(0x032b03e63fcaa3d0),
+        UINT64_C(0xf709ba4eb14129a2), UINT64_C(0x2aa0483051c25a0f),
+        UINT64_C(0x8d946634035823c3), UINT64_C(0x503d944ae3db506e),
+        UINT64_C(0xa41f2de26d50da1c), UINT64_C(0x79b6df9c8dd3a9b1),
+        UINT64_C(0x78afdec1676a3701), UINT64_C(0xa5062cbf87e944ac),
+        UINT64_C(0x512495170962cede), UINT64_C(0x8c8d6769e9e1bd73),
+        UINT64_C(0x2bb9496dbb7bc4bf), UINT64_C(0xf610bb135bf8b712),
+        UINT64_C(0x023202bbd5733d60), UINT64_C(0xdf9bf0c535f04ecd),
+        UINT64_C(0x2fdd4c1a119dbe7f), UINT64_C(0xf274be64f11ecdd2),
+        UINT64_C(0x065607cc7f9547a0), UINT64_C(0xdbfff5b29f16340d),
+        UINT64_C(0x7ccbdbb6cd8c4dc1), UINT64_C(0xa16229c82d0f3e6c),
+        UINT64_C(0x55409060a384b41e), UINT64_C(0x88e9621e4307c7b3),
+        UINT64_C(0x89f06343a9be5903), UINT64_C(0x5459913d493d2aae),
+        UINT64_C(0xa07b2895c7b6a0dc), UINT64_C(0x7dd2daeb2735d371),
+        UINT64_C(0xdae6f4ef75afaabd), UINT64_C(0x074f0691952cd910),
+        UINT64_C(0xf36dbf391ba75362), UINT64_C(0x2ec44d47fb2420cf),
+        UINT64_C(0xf15fbd82ced46e02), UINT64_C(0x2cf64ffc2e571daf),
+        UINT64_C(0xd8d4f654a0dc97dd), UINT64_C(0x057d042a405fe470),
+        UINT64_C(0xa2492a2e12c59dbc), UINT64_C(0x7fe0d850f246ee11),
+        UINT64_C(0x8bc261f87ccd6463), UINT64_C(0x566b93869c4e17ce),
+        UINT64_C(0x577292db76f7897e), UINT64_C(0x8adb60a59674fad3),
+        UINT64_C(0x7ef9d90d18ff70a1), UINT64_C(0xa3502b73f87c030c),
+        UINT64_C(0x04640577aae67ac0), UINT64_C(0xd9cdf7094a65096d),
+        UINT64_C(0x2def4ea1c4ee831f), UINT64_C(0xf046bcdf246df0b2),
+        UINT64_C(0x5fba9834233b7cfe), UINT64_C(0x82136a4ac3b80f53),
+        UINT64_C(0x7631d3e24d338521), UINT64_C(0xab98219cadb0f68c),
+        UINT64_C(0x0cac0f98ff2a8f40), UINT64_C(0xd105fde61fa9fced),
+        UINT64_C(0x2527444e9122769f), UINT64_C(0xf88eb63071a10532),
+        UINT64_C(0xf997b76d9b189b82), UINT64_C(0x243e45137b9be82f),
+        UINT64_C(0xd01cfcbbf510625d), UINT64_C(0x0db50ec5159311f0),
+        UINT64_C(0xaa8120c14709683c), UINT64_C(0x7728d2bfa78a1b91),
+        UINT64_C(0x830a6b17290191e3), UINT64_C(0x5ea39969c982e24e),
+        UINT64_C(0x813869acfc72ac83), UINT64_C(0x5c919bd21cf1df2e),
+        UINT64_C(0xa8b3227a927a555c), UINT64_C(0x751ad00472f926f1),
+        UINT64_C(0xd22efe0020635f3d), UINT64_C(0x0f870c7ec0e02c90),
+        UINT64_C(0xfba5b5d64e6ba6e2), UINT64_C(0x260c47a8aee8d54f),
+        UINT64_C(0x271546f544514bff), UINT64_C(0xfabcb48ba4d23852),
+        UINT64_C(0x0e9e0d232a59b220), UINT64_C(0xd337ff5dcadac18d),
+        UINT64_C(0x7403d1599840b841), UINT64_C(0xa9aa232778c3cbec),
+        UINT64_C(0x5d889a8ff648419e), UINT64_C(0x802168f116cb3233),
+        UINT64_C(0x7067d42e32a6c281), UINT64_C(0xadce2650d225b12c),
+        UINT64_C(0x59ec9ff85cae3b5e), UINT64_C(0x84456d86bc2d48f3),
+        UINT64_C(0x23714382eeb7313f), UINT64_C(0xfed8b1fc0e344292),
+        UINT64_C(0x0afa085480bfc8e0), UINT64_C(0xd753fa2a603cbb4d),
+        UINT64_C(0xd64afb778a8525fd), UINT64_C(0x0be309096a065650),
+        UINT64_C(0xffc1b0a1e48ddc22), UINT64_C(0x226842df040eaf8f),
+        UINT64_C(0x855c6cdb5694d643), UINT64_C(0x58f59ea5b617a5ee),
+        UINT64_C(0xacd7270d389c2f9c), UINT64_C(0x717ed573d81f5c31),
+        UINT64_C(0xaee525b6edef12fc), UINT64_C(0x734cd7c80d6c6151),
+        UINT64_C(0x876e6e6083e7eb23), UINT64_C(0x5ac79c1e6364988e),
+        UINT64_C(0xfdf3b21a31fee142), UINT64_C(0x205a4064d17d92ef),
+        UINT64_C(0xd478f9cc5ff6189d), UINT64_C(0x09d10bb2bf756b30),
+        UINT64_C(0x08c80aef55ccf580), UINT64_C(0xd561f891b54f862d),
+        UINT64_C(0x214341393bc40c5f), UINT64_C(0xfceab347db477ff2),
+        UINT64_C(0x5bde9d4389dd063e), UINT64_C(0x86776f3d695e7593),
+        UINT64_C(0x7255d695e7d5ffe1), UINT64_C(0xaffc24eb07568c4c),
+        UINT64_C(0xbf7530684676f9fc), UINT64_C(0x62dcc216a6f58a51),
+        UINT64_C(0x96fe7bbe287e0023), UINT64_C(0x4b5789c0c8fd738e),
+        UINT64_C(0xec63a7c49a670a42), UINT64_C(0x31ca55ba7ae479ef),
+        UINT64_C(0xc5e8ec12f46ff39d), UINT64_C(0x18411e6c14ec8030),
+        UINT64_C(0x19581f31fe551e80), UINT64_C(0xc4f1ed4f1ed66d2d),
+        UINT64_C(0x30d354e7905de75f), UINT64_C(0xed7aa69970de94f2),
+        UINT64_C(0x4a4e889d2244ed3e), UINT64_C(0x97e77ae3c2c79e93),
+        UINT64_C(0x63c5c34b4c4c14e1), UINT64_C(0xbe6c3135accf674c),
+        UINT64_C(0x61f7c1f0993f2981), UINT64_C(0xbc5e338e79bc5a2c),
+        UINT64_C(0x487c8a26f737d05e), UINT64_C(0x95d5785817b4a3f3),
+        UINT64_C(0x32e1565c452eda3f), UINT64_C(0xef48a422a5ada992),
+        UINT64_C(0x1b6a1d8a2b2623e0), UINT64_C(0xc6c3eff4cba5504d),
+        UINT64_C(0xc7daeea9211ccefd), UINT64_C(0x1a731cd7c19fbd50),
+        UINT64_C(0xee51a57f4f143722), UINT64_C(0x33f85701af97448f),
+        UINT64_C(0x94cc7905fd0d3d43), UINT64_C(0x49658b7b1d8e4eee),
+        UINT64_C(0xbd4732d39305c49c), UINT64_C(0x60eec0ad7386b731),
+        UINT64_C(0x90a87c7257eb4783), UINT64_C(0x4d018e0cb768342e),
+        UINT64_C(0xb92337a439e3be5c), UINT64_C(0x648ac5dad960cdf1),
+        UINT64_C(0xc3beebde8bfab43d), UINT64_C(0x1e1719a06b79c790),
+        UINT64_C(0xea35a008e5f24de2), UINT64_C(0x379c527605713e4f),
+        UINT64_C(0x3685532befc8a0ff), UINT64_C(0xeb2ca1550f4bd352),
+        UINT64_C(0x1f0e18fd81c05920), UINT64_C(0xc2a7ea8361432a8d),
+        UINT64_C(0x6593c48733d95341), UINT64_C(0xb83a36f9d35a20ec),
+        UINT64_C(0x4c188f515dd1aa9e), UINT64_C(0x91b17d2fbd52d933),
+        UINT64_C(0x4e2a8dea88a297fe), UINT64_C(0x93837f946821e453),
+        UINT64_C(0x67a1c63ce6aa6e21), UINT64_C(0xba08344206291d8c),
+        UINT64_C(0x1d3c1a4654b36440), UINT64_C(0xc095e838b43017ed),
+        UINT64_C(0x34b751903abb9d9f), UINT64_C(0xe91ea3eeda38ee32),
+        UINT64_C(0xe807a2b330817082), UINT64_C(0x35ae50cdd002032f),
+        UINT64_C(0xc18ce9655e89895d), UINT64_C(0x1c251b1bbe0afaf0),
+        UINT64_C(0xbb11351fec90833c), UINT64_C(0x66b8c7610c13f091),
+        UINT64_C(0x929a7ec982987ae3), UINT64_C(0x4f338cb7621b094e),
+        UINT64_C(0xe0cfa85c654d8502), UINT64_C(0x3d665a2285cef6af),
+        UINT64_C(0xc944e38a0b457cdd), UINT64_C(0x14ed11f4ebc60f70),
+        UINT64_C(0xb3d93ff0b95c76bc), UINT64_C(0x6e70cd8e59df0511),
+        UINT64_C(0x9a527426d7548f63), UINT64_C(0x47fb865837d7fcce),
+        UINT64_C(0x46e28705dd6e627e), UINT64_C(0x9b4b757b3ded11d3),
+        UINT64_C(0x6f69ccd3b3669ba1), UINT64_C(0xb2c03ead53e5e80c),
+        UINT64_C(0x15f410a9017f91c0), UINT64_C(0xc85de2d7e1fce26d),
+        UINT64_C(0x3c7f5b7f6f77681f), UINT64_C(0xe1d6a9018ff41bb2),
+        UINT64_C(0x3e4d59c4ba04557f), UINT64_C(0xe3e4abba5a8726d2),
+        UINT64_C(0x17c61212d40caca0), UINT64_C(0xca6fe06c348fdf0d),
+        UINT64_C(0x6d5bce686615a6c1), UINT64_C(0xb0f23c168696d56c),
+        UINT64_C(0x44d085be081d5f1e), UINT64_C(0x997977c0e89e2cb3),
+        UINT64_C(0x9860769d0227b203), UINT64_C(0x45c984e3e2a4c1ae),
+        UINT64_C(0xb1eb3d4b6c2f4bdc), UINT64_C(0x6c42cf358cac3871),
+        UINT64_C(0xcb76e131de3641bd), UINT64_C(0x16df134f3eb53210),
+        UINT64_C(0xe2fdaae7b03eb862), UINT64_C(0x3f54589950bdcbcf),
+        UINT64_C(0xcf12e44674d03b7d), UINT64_C(0x12bb1638945348d0),
+        UINT64_C(0xe699af901ad8c2a2), UINT64_C(0x3b305deefa5bb10f),
+        UINT64_C(0x9c0473eaa8c1c8c3), UINT64_C(0x41ad81944842bb6e),
+        UINT64_C(0xb58f383cc6c9311c), UINT64_C(0x6826ca42264a42b1),
+        UINT64_C(0x693fcb1fccf3dc01), UINT64_C(0xb49639612c70afac),
+        UINT64_C(0x40b480c9a2fb25de), UINT64_C(0x9d1d72b742785673),
+        UINT64_C(0x3a295cb310e22fbf), UINT64_C(0xe780aecdf0615c12),
+        UINT64_C(0x13a217657eead660), UINT64_C(0xce0be51b9e69a5cd),
+        UINT64_C(0x119015deab99eb00), UINT64_C(0xcc39e7a04b1a98ad),
+        UINT64_C(0x381b5e08c59112df), UINT64_C(0xe5b2ac7625126172),
+        UINT64_C(0x42868272778818be), UINT64_C(0x9f2f700c970b6b13),
+        UINT64_C(0x6b0dc9a41980e161), UINT64_C(0xb6a43bdaf90392cc),
+        UINT64_C(0xb7bd3a8713ba0c7c), UINT64_C(0x6a14c8f9f3397fd1),
+        UINT64_C(0x9e3671517db2f5a3), UINT64_C(0x439f832f9d31860e),
+        UINT64_C(0xe4abad2bcfabffc2), UINT64_C(0x39025f552f288c6f),
+        UINT64_C(0xcd20e6fda1a3061d), UINT64_C(0x10891483412075b0)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x0dd9b4240837fd99),
+        UINT64_C(0x1bb36848106ffb32), UINT64_C(0x166adc6c185806ab),
+        UINT64_C(0x3766d09020dff664), UINT64_C(0x3abf64b428e80bfd),
+        UINT64_C(0x2cd5b8d830b00d56), UINT64_C(0x210c0cfc3887f0cf),
+        UINT64_C(0x6ecda12041bfecc8), UINT64_C(0x6314150449881151),
+        UINT64_C(0x757ec96851d017fa), UINT64_C(0x78a77d4c59e7ea63),
+        UINT64_C(0x59ab71b061601aac), UINT64_C(0x5472c5946957e735),
+        UINT64_C(0x421819f8710fe19e), UINT64_C(0x4fc1addc79381c07),
+        UINT64_C(0xdd9b4240837fd990), UINT64_C(0xd042f6648b482409),
+        UINT64_C(0xc6282a08931022a2), UINT64_C(0xcbf19e2c9b27df3b),
+        UINT64_C(0xeafd92d0a3a02ff4), UINT64_C(0xe72426f4ab97d26d),
+        UINT64_C(0xf14efa98b3cfd4c6), UINT64_C(0xfc974ebcbbf8295f),
+        UINT64_C(0xb356e360c2c03558), UINT64_C(0xbe8f5744caf7c8c1),
+        UINT64_C(0xa8e58b28d2afce6a), UINT64_C(0xa53c3f0cda9833f3),
+        UINT64_C(0x843033f0e21fc33c), UINT64_C(0x89e987d4ea283ea5),
+        UINT64_C(0x9f835bb8f270380e), UINT64_C(0x925aef9cfa47c597),
+        UINT64_C(0x29ee2baaa9f1ada5), UINT64_C(0x24379f8ea1c6503c),
+        UINT64_C(0x325d43e2b99e5697), UINT64_C(0x3f84f7c6b1a9ab0e),
+        UINT64_C(0x1e88fb3a892e5bc1), UINT64_C(0x13514f1e8119a658),
+        UINT64_C(0x053b93729941a0f3), UINT64_C(0x08e2275691765d6a),
+        UINT64_C(0x47238a8ae84e416d), UINT64_C(0x4afa3eaee079bcf4),
+        UINT64_C(0x5c90e2c2f821ba5f), UINT64_C(0x514956e6f01647c6),
+        UINT64_C(0x70455a1ac891b709), UINT64_C(0x7d9cee3ec0a64a90),
+        UINT64_C(0x6bf63252d8fe4c3b), UINT64_C(0x662f8676d0c9b1a2),
+        UINT64_C(0xf47569ea2a8e7435), UINT64_C(0xf9acddce22b989ac),
+        UINT64_C(0xefc601a23ae18f07), UINT64_C(0xe21fb58632d6729e),
+        UINT64_C(0xc313b97a0a518251), UINT64_C(0xceca0d5e02667fc8),
+        UINT64_C(0xd8a0d1321a3e7963), UINT64_C(0xd5796516120984fa),
+        UINT64_C(0x9ab8c8ca6b3198fd), UINT64_C(0x97617cee63066564),
+        UINT64_C(0x810ba0827b5e63cf), UINT64_C(0x8cd214a673699e56),
+        UINT64_C(0xadde185a4bee6e99), UINT64_C(0xa007ac7e43d99300),
+        UINT64_C(0xb66d70125b8195ab), UINT64_C(0xbbb4c43653b66832),
+        UINT64_C(0x53dc575553e35b4a), UINT64_C(0x5e05e3715bd4a6d3),
+        UINT64_C(0x486f3f1d438ca078), UINT64_C(0x45b68b394bbb5de1),
+        UINT64_C(0x64ba87c5733cad2e), UINT64_C(0x696333e17b0b50b7),
+        UINT64_C(0x7f09ef8d6353561c), UINT64_C(0x72d05ba96b64ab85),
+        UINT64_C(0x3d11f675125cb782), UINT64_C(0x30c842511a6b4a1b),
+        UINT64_C(0x26a29e3d02334cb0), UINT64_C(0x2b7b2a190a04b129),
+        UINT64_C(0x0a7726e5328341e6), UINT64_C(0x07ae92c13ab4bc7f),
+        UINT64_C(0x11c44ead22ecbad4), UINT64_C(0x1c1dfa892adb474d),
+        UINT64_C(0x8e471515d09c82da), UINT64_C(0x839ea131d8ab7f43),
+        UINT64_C(0x95f47d5dc0f379e8), UINT64_C(0x982dc979c8c48471),
+        UINT64_C(0xb921c585f04374be), UINT64_C(0xb4f871a1f8748927),
+        UINT64_C(0xa292adcde02c8f8c), UINT64_C(0xaf4b19e9e81b7215),
+        UINT64_C(0xe08ab43591236e12), UINT64_C(0xed5300119914938b),
+        UINT64_C(0xfb39dc7d814c9520), UINT64_C(0xf6e06859897b68b9),
+        UINT64_C(0xd7ec64a5b1fc9876), UINT64_C(0xda35d081b9cb65ef),
+        UINT64_C(0xcc5f0ceda1936344), UINT64_C(0xc186b8c9a9a49edd),
+        UINT64_C(0x7a327cfffa12f6ef), UINT64_C(0x77ebc8dbf2250b76),
+        UINT64_C(0x618114b7ea7d0ddd), UINT64_C(0x6c58a093e24af044),
+        UINT64_C(0x4d54ac6fdacd008b), UINT64_C(0x408d184bd2fafd12),
+        UINT64_C(0x56e7c427caa2fbb9), UINT64_C(0x5b3e7003c2950620),
+        UINT64_C(0x14ffdddfbbad1a27), UINT64_C(0x192669fbb39ae7be),
+        UINT64_C(0x0f4cb597abc2e115), UINT64_C(0x029501b3a3f51c8c),
+        UINT64_C(0x23990d4f9b72ec43), UINT64_C(0x2e40b96b934511da),
+        UINT64_C(0x382a65078b1d1771), UINT64_C(0x35f3d123832aeae8),
+        UINT64_C(0xa7a93ebf796d2f7f), UINT64_C(0xaa708a9b715ad2e6),
+        UINT64_C(0xbc1a56f76902d44d), UINT64_C(0xb1c3e2d3613529d4),
+        UINT64_C(0x90cfee2f59b2d91b), UINT64_C(0x9d165a0b51852482),
+        UINT64_C(0x8b7c866749dd2229), UINT64_C(0x86a5324341eadfb0),
+        UINT64_C(0xc9649f9f38d2c3b7), UINT64_C(0xc4bd2bbb30e53e2e),
+        UINT64_C(0xd2d7f7d728bd3885), UINT64_C(0xdf0e43f3208ac51c),
+        UINT64_C(0xfe024f0f180d35d3), UINT64_C(0xf3dbfb2b103ac84a),
+        UINT64_C(0xe5b127470862cee1), UINT64_C(0xe868936300553378),
+        UINT64_C(0xa7b8aeaaa7c6b694), UINT64_C(0xaa611a8eaff14b0d),
+        UINT64_C(0xbc0bc6e2b7a94da6), UINT64_C(0xb1d272c6bf9eb03f),
+        UINT64_C(0x90de7e3a871940f0), UINT64_C(0x9d07ca1e8f2ebd69),
+        UINT64_C(0x8b6d16729776bbc2), UINT64_C(0x86b4a2569f41465b),
+        UINT64_C(0xc9750f8ae6795a5c), UINT64_C(0xc4acbbaeee4ea7c5),
+        UINT64_C(0xd2c667c2f616a16e), UINT64_C(0xdf1fd3e6fe215cf7),
+        UINT64_C(0xfe13df1ac6a6ac38), UINT64_C(0xf3ca6b3ece9151a1),
+        UINT64_C(0xe5a0b752d6c9570a), UINT64_C(0xe8790376defeaa93),
+        UINT64_C(0x7a23ecea24b96f04), UINT64_C(0x77fa58ce2c8e929d),
+        UINT64_C(0x619084a234d69436), UINT64_C(0x6c4930863ce169af),
+        UINT64_C(0x4d453c7a04669960), UINT64_C(0x409c885e0c5164f9),
+        UINT64_C(0x56f6543214096252), UINT64_C(0x5b2fe0161c3e9fcb),
+        UINT64_C(0x14ee4dca650683cc), UINT64_C(0x1937f9ee6d317e55),
+        UINT64_C(0x0f5d2582756978fe), UINT64_C(0x028491a67d5e8567),
+        UINT64_C(0x23889d5a45d975a8), UINT64_C(0x2e51297e4dee8831),
+        UINT64_C(0x383bf51255b68e9a), UINT64_C(0x35e241365d817303),
+        UINT64_C(0x8e5685000e371b31), UINT64_C(0x838f31240600e6a8),
+        UINT64_C(0x95e5ed481e58e003), UINT64_C(0x983c596c166f1d9a),
+        UINT64_C(0xb93055902ee8ed55), UINT64_C(0xb4e9e1b426df10cc),
+        UINT64_C(0xa2833dd83e871667), UINT64_C(0xaf5a89fc36b0ebfe),
+        UINT64_C(0xe09b24204f88f7f9), UINT64_C(0xed42900447bf0a60),
+        UINT64_C(0xfb284c685fe70ccb), UINT64_C(0xf6f1f84c57d0f152),
+        UINT64_C(0xd7fdf4b06f57019d), UINT64_C(0xda2440946760fc04),
+        UINT64_C(0xcc4e9cf87f38faaf), UINT64_C(0xc19728dc770f0736),
+        UINT64_C(0x53cdc7408d48c2a1), UINT64_C(0x5e147364857f3f38),
+        UINT64_C(0x487eaf089d273993), UINT64_C(0x45a71b2c9510c40a),
+        UINT64_C(0x64ab17d0ad9734c5), UINT64_C(0x6972a3f4a5a0c95c),
+        UINT64_C(0x7f187f98bdf8cff7), UINT64_C(0x72c1cbbcb5cf326e),
+        UINT64_C(0x3d006660ccf72e69), UINT64_C(0x30d9d244c4c0d3f0),
+        UINT64_C(0x26b30e28dc98d55b), UINT64_C(0x2b6aba0cd4af28c2),
+        UINT64_C(0x0a66b6f0ec28d80d), UINT64_C(0x07bf02d4e41f2594),
+        UINT64_C(0x11d5deb8fc47233f), UINT64_C(0x1c0c6a9cf470dea6),
+        UINT64_C(0xf464f9fff425edde), UINT64_C(0xf9bd4ddbfc121047),
+        UINT64_C(0xefd791b7e44a16ec), UINT64_C(0xe20e2593ec7deb75),
+        UINT64_C(0xc302296fd4fa1bba), UINT64_C(0xcedb9d4bdccde623),
+        UINT64_C(0xd8b14127c495e088), UINT64_C(0xd568f503cca21d11),
+        UINT64_C(0x9aa958dfb59a0116), UINT64_C(0x9770ecfbbdadfc8f),
+        UINT64_C(0x811a3097a5f5fa24), UINT64_C(0x8cc384b3adc207bd),
+        UINT64_C(0xadcf884f9545f772), UINT64_C(0xa0163c6b9d720aeb),
+        UINT64_C(0xb67ce007852a0c40), UINT64_C(0xbba554238d1df1d9),
+        UINT64_C(0x29ffbbbf775a344e), UINT64_C(0x24260f9b7f6dc9d7),
+        UINT64_C(0x324cd3f76735cf7c), UINT64_C(0x3f9567d36f0232e5),
+        UINT64_C(0x1e996b2f5785c22a), UINT64_C(0x1340df0b5fb23fb3),
+        UINT64_C(0x052a036747ea3918), UINT64_C(0x08f3b7434fddc481),
+        UINT64_C(0x47321a9f36e5d886), UINT64_C(0x4aebaebb3ed2251f),
+        UINT64_C(0x5c8172d7268a23b4), UINT64_C(0x5158c6f32ebdde2d),
+        UINT64_C(0x7054ca0f163a2ee2), UINT64_C(0x7d8d7e2b1e0dd37b),
+        UINT64_C(0x6be7a2470655d5d0), UINT64_C(0x663e16630e622849),
+        UINT64_C(0xdd8ad2555dd4407b), UINT64_C(0xd053667155e3bde2),
+        UINT64_C(0xc639ba1d4dbbbb49), UINT64_C(0xcbe00e39458c46d0),
+        UINT64_C(0xeaec02c57d0bb61f), UINT64_C(0xe735b6e1753c4b86),
+        UINT64_C(0xf15f6a8d6d644d2d), UINT64_C(0xfc86dea96553b0b4),
+        UINT64_C(0xb34773751c6bacb3), UINT64_C(0xbe9ec751145c512a),
+        UINT64_C(0xa8f41b3d0c045781), UINT64_C(0xa52daf190433aa18),
+        UINT64_C(0x8421a3e53cb45ad7), UINT64_C(0x89f817c13483a74e),
+        UINT64_C(0x9f92cbad2cdba1e5), UINT64_C(0x924b7f8924ec5c7c),
+        UINT64_C(0x00119015deab99eb), UINT64_C(0x0dc82431d69c6472),
+        UINT64_C(0x1ba2f85dcec462d9), UINT64_C(0x167b4c79c6f39f40),
+        UINT64_C(0x37774085fe746f8f), UINT64_C(0x3aaef4a1f6439216),
+        UINT64_C(0x2cc428cdee1b94bd), UINT64_C(0x211d9ce9e62c6924),
+        UINT64_C(0x6edc31359f147523), UINT64_C(0x63058511972388ba),
+        UINT64_C(0x756f597d8f7b8e11), UINT64_C(0x78b6ed59874c7388),
+        UINT64_C(0x59bae1a5bfcb8347), UINT64_C(0x54635581b7fc7ede),
+        UINT64_C(0x420989edafa47875), UINT64_C(0x4fd03dc9a79385ec)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xf075e4ae5e05bdff),
+        UINT64_C(0x723366771305657b), UINT64_C(0x824682d94d00d884),
+        UINT64_C(0xe466ccee260acaf6), UINT64_C(0x14132840780f7709),
+        UINT64_C(0x9655aa99350faf8d), UINT64_C(0x66204e376b0a1272),
+        UINT64_C(0x5a1536f7e31b8b69), UINT64_C(0xaa60d259bd1e3696),
+        UINT64_C(0x28265080f01eee12), UINT64_C(0xd853b42eae1b53ed),
+        UINT64_C(0xbe73fa19c511419f), UINT64_C(0x4e061eb79b14fc60),
+        UINT64_C(0xcc409c6ed61424e4), UINT64_C(0x3c3578c08811991b),
+        UINT64_C(0xb42a6defc63716d2), UINT64_C(0x445f89419832ab2d),
+        UINT64_C(0xc6190b98d53273a9), UINT64_C(0x366cef368b37ce56),
+        UINT64_C(0x504ca101e03ddc24), UINT64_C(0xa03945afbe3861db),
+        UINT64_C(0x227fc776f338b95f), UINT64_C(0xd20a23d8ad3d04a0),
+        UINT64_C(0xee3f5b18252c9dbb), UINT64_C(0x1e4abfb67b292044),
+        UINT64_C(0x9c0c3d6f3629f8c0), UINT64_C(0x6c79d9c1682c453f),
+        UINT64_C(0x0a5997f60326574d), UINT64_C(0xfa2c73585d23eab2),
+        UINT64_C(0x786af18110233236), UINT64_C(0x881f152f4e268fc9),
+        UINT64_C(0xfa8c74f423603321), UINT64_C(0x0af9905a7d658ede),
+        UINT64_C(0x88bf12833065565a), UINT64_C(0x78caf62d6e60eba5),
+        UINT64_C(0x1eeab81a056af9d7), UINT64_C(0xee9f5cb45b6f4428),
+        UINT64_C(0x6cd9de6d166f9cac), UINT64_C(0x9cac3ac3486a2153),
+        UINT64_C(0xa0994203c07bb848), UINT64_C(0x50eca6ad9e7e05b7),
+        UINT64_C(0xd2aa2474d37edd33), UINT64_C(0x22dfc0da8d7b60cc),
+        UINT64_C(0x44ff8eede67172be), UINT64_C(0xb48a6a43b874cf41),
+        UINT64_C(0x36cce89af57417c5), UINT64_C(0xc6b90c34ab71aa3a),
+        UINT64_C(0x4ea6191be55725f3), UINT64_C(0xbed3fdb5bb52980c),
+        UINT64_C(0x3c957f6cf6524088), UINT64_C(0xcce09bc2a857fd77),
+        UINT64_C(0xaac0d5f5c35def05), UINT64_C(0x5ab5315b9d5852fa),
+        UINT64_C(0xd8f3b382d0588a7e), UINT64_C(0x2886572c8e5d3781),
+        UINT64_C(0x14b32fec064cae9a), UINT64_C(0xe4c6cb4258491365),
+        UINT64_C(0x6680499b1549cbe1), UINT64_C(0x96f5ad354b4c761e),
+        UINT64_C(0xf0d5e3022046646c), UINT64_C(0x00a007ac7e43d993),
+        UINT64_C(0x82e6857533430117), UINT64_C(0x729361db6d46bce8),
+        UINT64_C(0x67c046c3e9ce78c7), UINT64_C(0x97b5a26db7cbc538),
+        UINT64_C(0x15f320b4facb1dbc), UINT64_C(0xe586c41aa4cea043),
+        UINT64_C(0x83a68a2dcfc4b231), UINT64_C(0x73d36e8391c10fce),
+        UINT64_C(0xf195ec5adcc1d74a), UINT64_C(0x01e008f482c46ab5),
+        UINT64_C(0x3dd570340ad5f3ae), UINT64_C(0xcda0949a54d04e51),
+        UINT64_C(0x4fe6164319d096d5), UINT64_C(0xbf93f2ed47d52b2a),
+        UINT64_C(0xd9b3bcda2cdf3958), UINT64_C(0x29c6587472da84a7),
+        UINT64_C(0xab80daad3fda5c23), UINT64_C(0x5bf53e0361dfe1dc),
+        UINT64_C(0xd3ea2b2c2ff96e15), UINT64_C(0x239fcf8271fcd3ea),
+        UINT64_C(0xa1d94d5b3cfc0b6e), UINT64_C(0x51aca9f562f9b691),
+        UINT64_C(0x378ce7c209f3a4e3), UINT64_C(0xc7f9036c57f6191c),
+        UINT64_C(0x45bf81b51af6c198), UINT64_C(0xb5ca651b44f37c67),
+        UINT64_C(0x89ff1ddbcce2e57c), UINT64_C(0x798af97592e75883),
+        UINT64_C(0xfbcc7bacdfe78007), UINT64_C(0x0bb99f0281e23df8),
+        UINT64_C(0x6d99d135eae82f8a), UINT64_C(0x9dec359bb4ed9275),
+        UINT64_C(0x1faab742f9ed4af1), UINT64_C(0xefdf53eca7e8f70e),
+        UINT64_C(0x9d4c3237caae4be6), UINT64_C(0x6d39d69994abf619),
+        UINT64_C(0xef7f5440d9ab2e9d), UINT64_C(0x1f0ab0ee87ae9362),
+        UINT64_C(0x792afed9eca48110), UINT64_C(0x895f1a77b2a13cef),
+        UINT64_C(0x0b1998aeffa1e46b), UINT64_C(0xfb6c7c00a1a45994),
+        UINT64_C(0xc75904c029b5c08f), UINT64_C(0x372ce06e77b07d70),
+        UINT64_C(0xb56a62b73ab0a5f4), UINT64_C(0x451f861964b5180b),
+        UINT64_C(0x233fc82e0fbf0a79), UINT64_C(0xd34a2c8051bab786),
+        UINT64_C(0x510cae591cba6f02), UINT64_C(0xa1794af742bfd2fd),
+        UINT64_C(0x29665fd80c995d34), UINT64_C(0xd913bb76529ce0cb),
+        UINT64_C(0x5b5539af1f9c384f), UINT64_C(0xab20dd01419985b0),
+        UINT64_C(0xcd0093362a9397c2), UINT64_C(0x3d75779874962a3d),
+        UINT64_C(0xbf33f5413996f2b9), UINT64_C(0x4f4611ef67934f46),
+        UINT64_C(0x7373692fef82d65d), UINT64_C(0x83068d81b1876ba2),
+        UINT64_C(0x01400f58fc87b326), UINT64_C(0xf135ebf6a2820ed9),
+        UINT64_C(0x9715a5c1c9881cab), UINT64_C(0x6760416f978da154),
+        UINT64_C(0xe526c3b6da8d79d0), UINT64_C(0x155327188488c42f),
+        UINT64_C(0xcf808d87d39cf18e), UINT64_C(0x3ff569298d994c71),
+        UINT64_C(0xbdb3ebf0c09994f5), UINT64_C(0x4dc60f5e9e9c290a),
+        UINT64_C(0x2be64169f5963b78), UINT64_C(0xdb93a5c7ab938687),
+        UINT64_C(0x59d5271ee6935e03), UINT64_C(0xa9a0c3b0b896e3fc),
+        UINT64_C(0x9595bb7030877ae7), UINT64_C(0x65e05fde6e82c718),
+        UINT64_C(0xe7a6dd0723821f9c), UINT64_C(0x17d339a97d87a263),
+        UINT64_C(0x71f3779e168db011), UINT64_C(0x8186933048880dee),
+        UINT64_C(0x03c011e90588d56a), UINT64_C(0xf3b5f5475b8d6895),
+        UINT64_C(0x7baae06815abe75c), UINT64_C(0x8bdf04c64bae5aa3),
+        UINT64_C(0x0999861f06ae8227), UINT64_C(0xf9ec62b158ab3fd8),
+        UINT64_C(0x9fcc2c8633a12daa), UINT64_C(0x6fb9c8286da49055),
+        UINT64_C(0xedff4af120a448d1), UINT64_C(0x1d8aae5f7ea1f52e),
+        UINT64_C(0x21bfd69ff6b06c35), UINT64_C(0xd1ca3231a8b5d1ca),
+        UINT64_C(0x538cb0e8e5b5094e), UINT64_C(0xa3f95446bbb0b4b1),
+        UINT64_C(0xc5d91a71d0baa6c3), UINT64_C(0x35acfedf8ebf1b3c),
+        UINT64_C(0xb7ea7c06c3bfc3b8), UINT64_C(0x479f98a89dba7e47),
+        UINT64_C(0x350cf973f0fcc2af), UINT64_C(0xc5791dddaef97f50),
+        UINT64_C(0x473f9f04e3f9a7d4), UINT64_C(0xb74a7baabdfc1a2b),
+        UINT64_C(0xd16a359dd6f60859), UINT64_C(0x211fd13388f3b5a6),
+        UINT64_C(0xa35953eac5f36d22), UINT64_C(0x532cb7449bf6d0dd),
+        UINT64_C(0x6f19cf8413e749c6), UINT64_C(0x9f6c2b2a4de2f439),
+        UINT64_C(0x1d2aa9f300e22cbd), UINT64_C(0xed5f4d5d5ee79142),
+        UINT64_C(0x8b7f036a35ed8330), UINT64_C(0x7b0ae7c46be83ecf),
+        UINT64_C(0xf94c651d26e8e64b), UINT64_C(0x093981b378ed5bb4),
+        UINT64_C(0x8126949c36cbd47d), UINT64_C(0x7153703268ce6982),
+        UINT64_C(0xf315f2eb25ceb106), UINT64_C(0x036016457bcb0cf9),
+        UINT64_C(0x6540587210c11e8b), UINT64_C(0x9535bcdc4ec4a374),
+        UINT64_C(0x17733e0503c47bf0), UINT64_C(0xe706daab5dc1c60f),
+        UINT64_C(0xdb33a26bd5d05f14), UINT64_C(0x2b4646c58bd5e2eb),
+        UINT64_C(0xa900c41cc6d53a6f), UINT64_C(0x597520b298d08790),
+        UINT64_C(0x3f556e85f3da95e2), UINT64_C(0xcf208a2baddf281d),
+        UINT64_C(0x4d6608f2e0dff099), UINT64_C(0xbd13ec5cbeda4d66),
+        UINT64_C(0xa840cb443a528949), UINT64_C(0x58352fea645734b6),
+        UINT64_C(0xda73ad332957ec32), UINT64_C(0x2a06499d775251cd),
+        UINT64_C(0x4c2607aa1c5843bf), UINT64_C(0xbc53e304425dfe40),
+        UINT64_C(0x3e1561dd0f5d26c4), UINT64_C(0xce60857351589b3b),
+        UINT64_C(0xf255fdb3d9490220), UINT64_C(0x0220191d874cbfdf),
+        UINT64_C(0x80669bc4ca4c675b), UINT64_C(0x70137f6a9449daa4),
+        UINT64_C(0x1633315dff43c8d6), UINT64_C(0xe646d5f3a1467529),
+        UINT64_C(0x6400572aec46adad), UINT64_C(0x9475b384b2431052),
+        UINT64_C(0x1c6aa6abfc659f9b), UINT64_C(0xec1f4205a2602264),
+        UINT64_C(0x6e59c0dcef60fae0), UINT64_C(0x9e2c2472b165471f),
+        UINT64_C(0xf80c6a45da6f556d), UINT64_C(0x08798eeb846ae892),
+        UINT64_C(0x8a3f0c32c96a3016), UINT64_C(0x7a4ae89c976f8de9),
+        UINT64_C(0x467f905c1f7e14f2), UINT64_C(0xb60a74f2417ba90d),
+        UINT64_C(0x344cf62b0c7b7189), UINT64_C(0xc4391285527ecc76),
+        UINT64_C(0xa2195cb23974de04), UINT64_C(0x526cb81c677163fb),
+        UINT64_C(0xd02a3ac52a71bb7f), UINT64_C(0x205fde6b74740680),
+        UINT64_C(0x52ccbfb01932ba68), UINT64_C(0xa2b95b1e47370797),
+        UINT64_C(0x20ffd9c70a37df13), UINT64_C(0xd08a3d69543262ec),
+        UINT64_C(0xb6aa735e3f38709e), UINT64_C(0x46df97f0613dcd61),
+        UINT64_C(0xc49915292c3d15e5), UINT64_C(0x34ecf1877238a81a),
+        UINT64_C(0x08d98947fa293101), UINT64_C(0xf8ac6de9a42c8cfe),
+        UINT64_C(0x7aeaef30e92c547a), UINT64_C(0x8a9f0b9eb729e985),
+        UINT64_C(0xecbf45a9dc23fbf7), UINT64_C(0x1ccaa10782264608),
+        UINT64_C(0x9e8c23decf269e8c), UINT64_C(0x6ef9c77091232373),
+        UINT64_C(0xe6e6d25fdf05acba), UINT64_C(0x169336f181001145),
+        UINT64_C(0x94d5b428cc00c9c1), UINT64_C(0x64a050869205743e),
+        UINT64_C(0x02801eb1f90f664c), UINT64_C(0xf2f5fa1fa70adbb3),
+        UINT64_C(0x70b378c6ea0a0337), UINT64_C(0x80c69c68b40fbec8),
+        UINT64_C(0xbcf3e4a83c1e27d3), UINT64_C(0x4c860006621b9a2c),
+        UINT64_C(0xcec082df2f1b42a8), UINT64_C(0x3eb56671711eff57),
+        UINT64_C(0x589528461a14ed25), UINT64_C(0xa8e0cce8441150da),
+        UINT64_C(0x2aa64e310911885e), UINT64_C(0xdad3aa9f571435a1)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xe05dd497ca393ae4),
+        UINT64_C(0x526306043b7c6b4d), UINT64_C(0xb23ed293f14551a9),
+        UINT64_C(0xa4c60c0876f8d69a), UINT64_C(0x449bd89fbcc1ec7e),
+        UINT64_C(0xf6a50a0c4d84bdd7), UINT64_C(0x16f8de9b87bd8733),
+        UINT64_C(0xdb54b73b42ffb3b1), UINT64_C(0x3b0963ac88c68955),
+        UINT64_C(0x8937b13f7983d8fc), UINT64_C(0x696a65a8b3bae218),
+        UINT64_C(0x7f92bb333407652b), UINT64_C(0x9fcf6fa4fe3e5fcf),
+        UINT64_C(0x2df1bd370f7b0e66), UINT64_C(0xcdac69a0c5423482),
+        UINT64_C(0x2471c15d2af179e7), UINT64_C(0xc42c15cae0c84303),
+        UINT64_C(0x7612c759118d12aa), UINT64_C(0x964f13cedbb4284e),
+        UINT64_C(0x80b7cd555c09af7d), UINT64_C(0x60ea19c296309599),
+        UINT64_C(0xd2d4cb516775c430), UINT64_C(0x32891fc6ad4cfed4),
+        UINT64_C(0xff257666680eca56), UINT64_C(0x1f78a2f1a237f0b2),
+        UINT64_C(0xad4670625372a11b), UINT64_C(0x4d1ba4f5994b9bff),
+        UINT64_C(0x5be37a6e1ef61ccc), UINT64_C(0xbbbeaef9d4cf2628),
+        UINT64_C(0x09807c6a258a7781), UINT64_C(0xe9dda8fdefb34d65),
+        UINT64_C(0x48e382ba55e2f3ce), UINT64_C(0xa8be562d9fdbc92a),
+        UINT64_C(0x1a8084be6e9e9883), UINT64_C(0xfadd5029a4a7a267),
+        UINT64_C(0xec258eb2231a2554), UINT64_C(0x0c785a25e9231fb0),
+        UINT64_C(0xbe4688b618664e19), UINT64_C(0x5e1b5c21d25f74fd),
+        UINT64_C(0x93b73581171d407f), UINT64_C(0x73eae116dd247a9b),
+        UINT64_C(0xc1d433852c612b32), UINT64_C(0x2189e712e65811d6),
+        UINT64_C(0x3771398961e596e5), UINT64_C(0xd72ced1eabdcac01),
+        UINT64_C(0x65123f8d5a99fda8), UINT64_C(0x854feb1a90a0c74c),
+        UINT64_C(0x6c9243e77f138a29), UINT64_C(0x8ccf9770b52ab0cd),
+        UINT64_C(0x3ef145e3446fe164), UINT64_C(0xdeac91748e56db80),
+        UINT64_C(0xc8544fef09eb5cb3), UINT64_C(0x28099b78c3d26657),
+        UINT64_C(0x9a3749eb329737fe), UINT64_C(0x7a6a9d7cf8ae0d1a),
+        UINT64_C(0xb7c6f4dc3dec3998), UINT64_C(0x579b204bf7d5037c),
+        UINT64_C(0xe5a5f2d8069052d5), UINT64_C(0x05f8264fcca96831),
+        UINT64_C(0x1300f8d44b14ef02), UINT64_C(0xf35d2c43812dd5e6),
+        UINT64_C(0x4163fed07068844f), UINT64_C(0xa13e2a47ba51beab),
+        UINT64_C(0x91c70574abc5e79c), UINT64_C(0x719ad1e361fcdd78),
+        UINT64_C(0xc3a4037090b98cd1), UINT64_C(0x23f9d7e75a80b635),
+        UINT64_C(0x3501097cdd3d3106), UINT64_C(0xd55cddeb17040be2),
+        UINT64_C(0x67620f78e6415a4b), UINT64_C(0x873fdbef2c7860af),
+        UINT64_C(0x4a93b24fe93a542d), UINT64_C(0xaace66d823036ec9),
+        UINT64_C(0x18f0b44bd2463f60), UINT64_C(0xf8ad60dc187f0584),
+        UINT64_C(0xee55be479fc282b7), UINT64_C(0x0e086ad055fbb853),
+        UINT64_C(0xbc36b843a4bee9fa), UINT64_C(0x5c6b6cd46e87d31e),
+        UINT64_C(0xb5b6c42981349e7b), UINT64_C(0x55eb10be4b0da49f),
+        UINT64_C(0xe7d5c22dba48f536), UINT64_C(0x078816ba7071cfd2),
+        UINT64_C(0x1170c821f7cc48e1), UINT64_C(0xf12d1cb63df57205),
+        UINT64_C(0x4313ce25ccb023ac), UINT64_C(0xa34e1ab206891948),
+        UINT64_C(0x6ee27312c3cb2dca), UINT64_C(0x8ebfa78509f2172e),
+        UINT64_C(0x3c817516f8b74687), UINT64_C(0xdcdca181328e7c63),
+        UINT64_C(0xca247f1ab533fb50), UINT64_C(0x2a79ab8d7f0ac1b4),
+        UINT64_C(0x9847791e8e4f901d), UINT64_C(0x781aad894476aaf9),
+        UINT64_C(0xd92487cefe271452), UINT64_C(0x39795359341e2eb6),
+        UINT64_C(0x8b4781cac55b7f1f), UINT64_C(0x6b1a555d0f6245fb),
+        UINT64_C(0x7de28bc688dfc2c8), UINT64_C(0x9dbf5f5142e6f82c),
+        UINT64_C(0x2f818dc2b3a3a985), UINT64_C(0xcfdc5955799a9361),
+        UINT64_C(0x027030f5bcd8a7e3), UINT64_C(0xe22de46276e19d07),
+        UINT64_C(0x501336f187a4ccae), UINT64_C(0xb04ee2664d9df64a),
+        UINT64_C(0xa6b63cfdca207179), UINT64_C(0x46ebe86a00194b9d),
+        UINT64_C(0xf4d53af9f15c1a34), UINT64_C(0x1488ee6e3b6520d0),
+        UINT64_C(0xfd554693d4d66db5), UINT64_C(0x1d0892041eef5751),
+        UINT64_C(0xaf364097efaa06f8), UINT64_C(0x4f6b940025933c1c),
+        UINT64_C(0x59934a9ba22ebb2f), UINT64_C(0xb9ce9e0c681781cb),
+        UINT64_C(0x0bf04c9f9952d062), UINT64_C(0xebad9808536bea86),
+        UINT64_C(0x2601f1a89629de04), UINT64_C(0xc65c253f5c10e4e0),
+        UINT64_C(0x7462f7acad55b549), UINT64_C(0x943f233b676c8fad),
+        UINT64_C(0x82c7fda0e0d1089e), UINT64_C(0x629a29372ae8327a),
+        UINT64_C(0xd0a4fba4dbad63d3), UINT64_C(0x30f92f3311945937),
+        UINT64_C(0xb156a5c2f885d1bd), UINT64_C(0x510b715532bceb59),
+        UINT64_C(0xe335a3c6c3f9baf0), UINT64_C(0x0368775109c08014),
+        UINT64_C(0x1590a9ca8e7d0727), UINT64_C(0xf5cd7d5d44443dc3),
+        UINT64_C(0x47f3afceb5016c6a), UINT64_C(0xa7ae7b597f38568e),
+        UINT64_C(0x6a0212f9ba7a620c), UINT64_C(0x8a5fc66e704358e8),
+        UINT64_C(0x386114fd81060941), UINT64_C(0xd83cc06a4b3f33a5),
+        UINT64_C(0xcec41ef1cc82b496), UINT64_C(0x2e99ca6606bb8e72),
+        UINT64_C(0x9ca718f5f7fedfdb), UINT64_C(0x7cfacc623dc7e53f),
+        UINT64_C(0x9527649fd274a85a), UINT64_C(0x757ab008184d92be),
+        UINT64_C(0xc744629be908c317), UINT64_C(0x2719b60c2331f9f3),
+        UINT64_C(0x31e16897a48c7ec0), UINT64_C(0xd1bcbc006eb54424),
+        UINT64_C(0x63826e939ff0158d), UINT64_C(0x83dfba0455c92f69),
+        UINT64_C(0x4e73d3a4908b1beb), UINT64_C(0xae2e07335ab2210f),
+        UINT64_C(0x1c10d5a0abf770a6), UINT64_C(0xfc4d013761ce4a42),
+        UINT64_C(0xeab5dface673cd71), UINT64_C(0x0ae80b3b2c4af795),
+        UINT64_C(0xb8d6d9a8dd0fa63c), UINT64_C(0x588b0d3f17369cd8),
+        UINT64_C(0xf9b52778ad672273), UINT64_C(0x19e8f3ef675e1897),
+        UINT64_C(0xabd6217c961b493e), UINT64_C(0x4b8bf5eb5c2273da),
+        UINT64_C(0x5d732b70db9ff4e9), UINT64_C(0xbd2effe711a6ce0d),
+        UINT64_C(0x0f102d74e0e39fa4), UINT64_C(0xef4df9e32adaa540),
+        UINT64_C(0x22e19043ef9891c2), UINT64_C(0xc2bc44d425a1ab26),
+        UINT64_C(0x70829647d4e4fa8f), UINT64_C(0x90df42d01eddc06b),
+        UINT64_C(0x86279c4b99604758), UINT64_C(0x667a48dc53597dbc),
+        UINT64_C(0xd4449a4fa21c2c15), UINT64_C(0x34194ed8682516f1),
+        UINT64_C(0xddc4e62587965b94), UINT64_C(0x3d9932b24daf6170),
+        UINT64_C(0x8fa7e021bcea30d9), UINT64_C(0x6ffa34b676d30a3d),
+        UINT64_C(0x7902ea2df16e8d0e), UINT64_C(0x995f3eba3b57b7ea),
+        UINT64_C(0x2b61ec29ca12e643), UINT64_C(0xcb3c38be002bdca7),
+        UINT64_C(0x0690511ec569e825), UINT64_C(0xe6cd85890f50d2c1),
+        UINT64_C(0x54f3571afe158368), UINT64_C(0xb4ae838d342cb98c),
+        UINT64_C(0xa2565d16b3913ebf), UINT64_C(0x420b898179a8045b),
+        UINT64_C(0xf0355b1288ed55f2), UINT64_C(0x10688f8542d46f16),
+        UINT64_C(0x2091a0b653403621), UINT64_C(0xc0cc742199790cc5),
+        UINT64_C(0x72f2a6b2683c5d6c), UINT64_C(0x92af7225a2056788),
+        UINT64_C(0x8457acbe25b8e0bb), UINT64_C(0x640a7829ef81da5f),
+        UINT64_C(0xd634aaba1ec48bf6), UINT64_C(0x36697e2dd4fdb112),
+        UINT64_C(0xfbc5178d11bf8590), UINT64_C(0x1b98c31adb86bf74),
+        UINT64_C(0xa9a611892ac3eedd), UINT64_C(0x49fbc51ee0fad439),
+        UINT64_C(0x5f031b856747530a), UINT64_C(0xbf5ecf12ad7e69ee),
+        UINT64_C(0x0d601d815c3b3847), UINT64_C(0xed3dc916960202a3),
+        UINT64_C(0x04e061eb79b14fc6), UINT64_C(0xe4bdb57cb3887522),
+        UINT64_C(0x568367ef42cd248b), UINT64_C(0xb6deb37888f41e6f),
+        UINT64_C(0xa0266de30f49995c), UINT64_C(0x407bb974c570a3b8),
+        UINT64_C(0xf2456be73435f211), UINT64_C(0x1218bf70fe0cc8f5),
+        UINT64_C(0xdfb4d6d03b4efc77), UINT64_C(0x3fe90247f177c693),
+        UINT64_C(0x8dd7d0d40032973a), UINT64_C(0x6d8a0443ca0badde),
+        UINT64_C(0x7b72dad84db62aed), UINT64_C(0x9b2f0e4f878f1009),
+        UINT64_C(0x2911dcdc76ca41a0), UINT64_C(0xc94c084bbcf37b44),
+        UINT64_C(0x6872220c06a2c5ef), UINT64_C(0x882ff69bcc9bff0b),
+        UINT64_C(0x3a1124083ddeaea2), UINT64_C(0xda4cf09ff7e79446),
+        UINT64_C(0xccb42e04705a1375), UINT64_C(0x2ce9fa93ba632991),
+        UINT64_C(0x9ed728004b267838), UINT64_C(0x7e8afc97811f42dc),
+        UINT64_C(0xb3269537445d765e), UINT64_C(0x537b41a08e644cba),
+        UINT64_C(0xe14593337f211d13), UINT64_C(0x011847a4b51827f7),
+        UINT64_C(0x17e0993f32a5a0c4), UINT64_C(0xf7bd4da8f89c9a20),
+        UINT64_C(0x45839f3b09d9cb89), UINT64_C(0xa5de4bacc3e0f16d),
+        UINT64_C(0x4c03e3512c53bc08), UINT64_C(0xac5e37c6e66a86ec),
+        UINT64_C(0x1e60e555172fd745), UINT64_C(0xfe3d31c2dd16eda1),
+        UINT64_C(0xe8c5ef595aab6a92), UINT64_C(0x08983bce90925076),
+        UINT64_C(0xbaa6e95d61d701df), UINT64_C(0x5afb3dcaabee3b3b),
+        UINT64_C(0x9757546a6eac0fb9), UINT64_C(0x770a80fda495355d),
+        UINT64_C(0xc534526e55d064f4), UINT64_C(0x256986f99fe95e10),
+        UINT64_C(0x339158621854d923), UINT64_C(0xd3cc8cf5d26de3c7),
+        UINT64_C(0x61f25e662328b26e), UINT64_C(0x81af8af1e911888a)
+    }
+};
+
+/* Reference implementation, one byte per step */
+static uint64_t update_bytewise(uint64_t cs, uint8_t const* data, size_t nbytes) {
     while (nbytes-- != 0) {
         uint8_t idx = (uint8_t)((cs ^ *data++) & 0xff);
         cs = table[idx] ^ (cs >> 8);
     }
 
+    return cs;
+}
+
+/* Slice-by-16, processes 16 bytes per step with one lookup per byte */
+static uint64_t update_slice16(uint64_t cs, uint8_t const* data, size_t nbytes) {
+    while (nbytes >= 16) {
+        cs ^= (uint64_t)data[0] | (uint64_t)data[1] << 8 | (uint64_t)data[2] << 16 | (uint64_t)data[3] << 24 |
+              (uint64_t)data[4] << 32 | (uint64_t)data[5] << 40 | (uint64_t)data[6] << 48 | (uint64_t)data[7] << 56;
+
+        cs = slice[15][cs & 0xff] ^ slice[14][(cs >> 8) & 0xff] ^
+             slice[13][(cs >> 16) & 0xff] ^ slice[12][(cs >> 24) & 0xff] ^
+             slice[11][(cs >> 32) & 0xff] ^ slice[10][(cs >> 40) & 0xff] ^
+             slice[9][(cs >> 48) & 0xff] ^ slice[8][cs >> 56] ^
+             slice[7][data[8]] ^ slice[6][data[9]] ^ slice[5][data[10]] ^ slice[4][data[11]] ^
+             slice[3][data[12]] ^ slice[2][data[13]] ^ slice[1][data[14]] ^ slice[0][data[15]];
+
+        data += 16;
+        nbytes -= 16;
+    }
+
+    return update_bytewise(cs, data, nbytes);
+}
+
+typedef uint64_t (*Kernel)(uint64_t cs, uint8_t const* data, size_t nbytes);
+
+#ifdef CRC64_CLMUL
+/*
+Carry-less multiplication folding, see "Fast CRC Computation for Generic
+Polynomials Using PCLMULQDQ Instruction" by Gopal et al. All values are bit
+reflected, so multiplying two of them also multiplies the result by x.
+*/
+
+/* Folding constants for distances of 128, 512, 1024 and 2048 bits, x^(n + 63) and x^(n - 1) mod P */
+static uint64_t const fold128[2] = {UINT64_C(0xe05dd497ca393ae4), UINT64_C(0xdabe95afc7875f40)};
+static uint64_t const fold512[2] = {UINT64_C(0x6ae3efbb9dd441f3), UINT64_C(0x081f6054a7842df4)};
+static uint64_t const fold1024[2] = {UINT64_C(0x8757d71d4fcc1000), UINT64_C(0xd7d86b2af73de740)};
+static uint64_t const fold2048[2] = {UINT64_C(0x8260adf2381ad81c), UINT64_C(0xf31fd9271e228b79)};
+
+/* floor(x^128 / P) and P, both without the implicit 65th bit */
+#define CRC64_MU   UINT64_C(0x9c3e466c172963d5)
+#define CRC64_POLY UINT64_C(0x92d8af2baf0e1e85)
+
+__attribute__((target("sse2,pclmul")))
+static __m128i fold_128(__m128i const x, __m128i const k, __m128i const data) {
+    __m128i const lo = _mm_clmulepi64_si128(x, k, 0x00);
+    __m128i const hi = _mm_clmulepi64_si128(x, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), data);
+}
+
+/* Folds the remaining 16-byte blocks into x, then reduces it to 64 bits */
+__attribute__((target("sse2,pclmul")))
+static uint64_t reduce_128(__m128i x, uint8_t const* data, size_t nbytes) {
+    __m128i const k = _mm_loadu_si128((__m128i const*)fold128);
+
+    while (nbytes >= 16) {
+        x = fold_128(x, k, _mm_loadu_si128((__m128i const*)data));
+        data += 16;
+        nbytes -= 16;
+    }
+
+    /* x * x^64 fits in 128 bits after folding the low half over the high one */
+    __m128i const h = _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x10), _mm_srli_si128(x, 8));
+
+    /* Barrett reduction */
+    __m128i const mu_poly = _mm_set_epi64x((long long)CRC64_POLY, (long long)CRC64_MU);
+    __m128i const t1 = _mm_clmulepi64_si128(h, mu_poly, 0x00);
+    __m128i const t2 = _mm_xor_si128(_mm_clmulepi64_si128(t1, mu_poly, 0x10), _mm_slli_si128(t1, 8));
+    __m128i const r = _mm_xor_si128(h, t2);
+
+    uint64_t const cs = (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(r, r));
+    return update_slice16(cs, data, nbytes);
+}
+
+__attribute__((target("sse2,pclmul")))
+static uint64_t update_clmul(uint64_t cs, uint8_t const* data, size_t nbytes) {
+    if (nbytes < 256) {
+        return update_slice16(cs, data, nbytes);
+    }
+
+    __m128i x[8];
+
+    for (int i = 0; i < 8; i++) {
+        x[i] = _mm_loadu_si128((__m128i const*)(data + i * 16));
+    }
+
+    x[0] = _mm_xor_si128(x[0], _mm_cvtsi64_si128((long long)cs));
+    data += 128;
+    nbytes -= 128;
+
+    __m128i const k = _mm_loadu_si128((__m128i const*)fold1024);
+
+    while (nbytes >= 128) {
+        for (int i = 0; i < 8; i++) {
+            x[i] = fold_128(x[i], k, _mm_loadu_si128((__m128i const*)(data + i * 16)));
+        }
+
+        data += 128;
+        nbytes -= 128;
+    }
+
+    __m128i const k128 = _mm_loadu_si128((__m128i const*)fold128);
+
+    for (int i = 1; i < 8; i++) {
+        x[0] = fold_128(x[0], k128, x[i]);
+    }
+
+    return reduce_128(x[0], data, nbytes);
+}
+
+__attribute__((target("avx512f,vpclmulqdq")))
+static __m512i fold_512(__m512i const x, __m512i const k, __m512i const data) {
+    __m512i const lo = _mm512_clmulepi64_epi128(x, k, 0x00);
+    __m512i const hi = _mm512_clmulepi64_epi128(x, k, 0x11);
+    return _mm512_ternarylogic_epi64(lo, hi, data, 0x96);
+}
+
+__attribute__((target("avx512f,vpclmulqdq,pclmul")))
+static uint64_t update_vpclmul(uint64_t cs, uint8_t const* data, size_t nbytes) {
+    if (nbytes < 1024) {
+        return update_clmul(cs, data, nbytes);
+    }
+
+    __m512i x[4];
+
+    for (int i = 0; i < 4; i++) {
+        x[i] = _mm512_loadu_si512((void const*)(data + i * 64));
+    }
+
+    x[0] = _mm512_xor_si512(x[0], _mm512_zextsi128_si512(_mm_cvtsi64_si128((long long)cs)));
+    data += 256;
+    nbytes -= 256;
+
+    __m512i const k = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const*)fold2048));
+
+    while (nbytes >= 256) {
+        for (int i = 0; i < 4; i++) {
+            x[i] = fold_512(x[i], k, _mm512_loadu_si512((void const*)(data + i * 64)));
+        }
+
+        data += 256;
+        nbytes -= 256;
+    }
+
+    __m512i const k512 = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const*)fold512));
+
+    for (int i = 1; i < 4; i++) {
+        x[0] = fold_512(x[0], k512, x[i]);
+    }
+
+    __m128i const k128 = _mm_loadu_si128((__m128i const*)fold128);
+    __m128i y = _mm512_extracti32x4_epi32(x[0], 0);
+    y = fold_128(y, k128, _mm512_extracti32x4_epi32(x[0], 1));
+    y = fold_128(y, k128, _mm512_extracti32x4_epi32(x[0], 2));
+    y = fold_128(y, k128, _mm512_extracti32x4_epi32(x[0], 3));
+
+    return reduce_128(y, data, nbytes);
+}
+
+static Kernel select_kernel(void) {
+    unsigned eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & bit_PCLMUL) == 0) {
+        return update_slice16;
+    }
+
+    /* VPCLMULQDQ on 512-bit registers needs AVX-512F, and the OS saving ZMM state */
+    if ((ecx & bit_OSXSAVE) == 0 || !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return update_clmul;
+    }
+
+    if ((ebx & bit_AVX512F) == 0 || (ecx & bit_VPCLMULQDQ) == 0) {
+        return update_clmul;
+    }
+
+    unsigned xcr0_lo, xcr0_hi;
+    __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+
+    return (xcr0_lo & 0xe6) == 0xe6 ? update_vpclmul : update_clmul;
+}
+
+static uint64_t update_first(uint64_t cs, uint8_t const* data, size_t nbytes);
+
+/*
+The kernel is selected on the first call. Threads racing on it all store the
+same value, and the atomic accesses keep that well defined.
+*/
+static Kernel kernel = update_first;
+
+static uint64_t update_first(uint64_t cs, uint8_t const* data, size_t nbytes) {
+    Kernel const selected = select_kernel();
+    __atomic_store_n(&kernel, selected, __ATOMIC_RELAXED);
+    return selected(cs, data, nbytes);
+}
+
+static uint64_t update(uint64_t cs, uint8_t const* data, size_t nbytes) {
+    return __atomic_load_n(&kernel, __ATOMIC_RELAXED)(cs, data, nbytes);
+}
+#else
+static uint64_t update(uint64_t cs, uint8_t const* data, size_t nbytes) {
+    return update_slice16(cs, data, nbytes);
+}
+#endif
+
+/* x2n[k] is x^(2^k) mod P, bit reflected */
+static uint64_t const x2n[64] = {
+    UINT64_C(0x4000000000000000), UINT64_C(0x2000000000000000),
+    UINT64_C(0x0800000000000000), UINT64_C(0x0080000000000000),
+    UINT64_C(0x0000800000000000), UINT64_C(0x0000000080000000),
+    UINT64_C(0xc96c5795d7870f42), UINT64_C(0x6d5f4ad7e3c3afa0),
+    UINT64_C(0xd49f7e445077d8ea), UINT64_C(0x040fb02a53c216fa),
+    UINT64_C(0x6bec35957b9ef3a0), UINT64_C(0xb0e3bb0658964afe),
+    UINT64_C(0x218578c7a2dff638), UINT64_C(0x6dbb920f24dd5cf2),
+    UINT64_C(0x7a140cfcdb4d5eb5), UINT64_C(0x41b3705ecbc4057b),
+    UINT64_C(0xd46ab656accac1ea), UINT64_C(0x329beda6fc34fb73),
+    UINT64_C(0x51a4fcd4350b9797), UINT64_C(0x314fa85637efae9d),
+    UINT64_C(0xacf27e9a1518d512), UINT64_C(0xffe2a3388a4d8ce7),
+    UINT64_C(0x48b9697e60cc2e4e), UINT64_C(0xada73cb78dd62460),
+    UINT64_C(0x3ea5454d8ce5c1bb), UINT64_C(0x5e84e3a6c70feaf1),
+    UINT64_C(0x90fd49b66cbd81d1), UINT64_C(0xe2943e0c1db254e8),
+    UINT64_C(0xecfa6adeca8834a1), UINT64_C(0xf513e212593ee321),
+    UINT64_C(0xf36ae57331040916), UINT64_C(0x63fbd333b87b6717),
+    UINT64_C(0xbd60f8e152f50b8b), UINT64_C(0xa5ce4a8299c1567d),
+    UINT64_C(0x0bd445f0cbdb55ee), UINT64_C(0xfdd6824e20134285),
+    UINT64_C(0xcead8b6ebda2227a), UINT64_C(0xe44b17e4f5d4fb5c),
+    UINT64_C(0x9b29c81ad01ca7c5), UINT64_C(0x1b4366e40fea4055),
+    UINT64_C(0x27bca1551aae167b), UINT64_C(0xaa57bcd1b39a5690),
+    UINT64_C(0xd7fce83fa1234db9), UINT64_C(0xcce4986efea3ff8e),
+    UINT64_C(0x3602a4d9e65341f1), UINT64_C(0x722b1da2df516145),
+    UINT64_C(0xecfc3ddd3a08da83), UINT64_C(0x0fb96dcca83507e6),
+    UINT64_C(0x125f2fe78d70f080), UINT64_C(0x842f50b7651aa516),
+    UINT64_C(0x09bc34188cd9836f), UINT64_C(0xf43666c84196d909),
+    UINT64_C(0xb56feb30c0df6ccb), UINT64_C(0xaa66e04ce7f30958),
+    UINT64_C(0xb7b1187e9af29547), UINT64_C(0x113255f8476495de),
+    UINT64_C(0x8fb19f783095d77e), UINT64_C(0xaec4aacc7c82b133),
+    UINT64_C(0xf64e6d09218428cf), UINT64_C(0x036a72ea5ac258a0),
+    UINT64_C(0x5235ef12eb7aaa6a), UINT64_C(0x2fed7b1685657853),
+    UINT64_C(0x8ef8951d46606fb5), UINT64_C(0x9d58c1090f034d14)
+};
+
+/* a * b mod P, bit reflected */
+static uint64_t multmodp(uint64_t a, uint64_t b) {
+    uint64_t m = UINT64_C(1) << 63;
+    uint64_t p = 0;
+
+    for (;;) {
+        if ((a & m) != 0) {
+            p ^= b;
+
+            if ((a & (m - 1)) == 0) {
+                break;
+            }
+        }
+
+        m >>= 1;
+        b = (b >> 1) ^ (b & 1 ? UINT64_C(0xc96c5795d7870f42) : 0);
+    }
+
+    return p;
+}
+
+/* x^(n * 2^k) mod P, bit reflected */
+static uint64_t x2nmodp(uint64_t n, unsigned k) {
+    uint64_t p = UINT64_C(1) << 63;
+
+    while (n != 0) {
+        if ((n & 1) != 0) {
+            p = multmodp(x2n[k & 63], p);
+        }
+
+        n >>= 1;
+        k++;
+    }
+
+    return p;
+}
+
+uint64_t crc64(void const* input, size_t nbytes) {
+    uint64_t const cs = update(UINT64_C(0xffffffffffffffff), (uint8_t const*)input, nbytes);
     return cs ^ UINT64_C(0xffffffffffffffff);
 }
 
+/* Returns the CRC of A followed by B, given the CRCs of both and the length of B */
+uint64_t crc64_combine(uint64_t crc_a, uint64_t crc_b, size_t nbytes_b) {
+    return multmodp(x2nmodp(nbytes_b, 3), crc_a) ^ crc_b;
+}
+
 #include <lua.h>
 #include <lauxlib.h>
 
 #define CRC64_MT "crc64"
+#define CRC64_STATE_MT "crc64.state"
 
 static int l_eq(lua_State* const L) {
     uint64_t* const self = luaL_testudata(L, 1, CRC64_MT);
@@ -217,10 +2606,7 @@ static int l_tostring(lua_State* const L) {
     return 1;
 }
 
-static int push_crc(lua_State* const L, uint64_t const crc) {
-    uint64_t* const self = lua_newuserdata(L, sizeof(*self));
-    *self = crc;
-
+static void push_metatable(lua_State* const L) {
     if (luaL_newmetatable(L, CRC64_MT)) {
         lua_pushcfunction(L, l_eq);
         lua_setfield(L, -2, "__eq");
@@ -231,11 +2617,23 @@ static int push_crc(lua_State* const L, uint64_t const crc) {
         lua_pushliteral(L, "crc64");
         lua_setfield(L, -2, "__name");
     }
+}
+
+/* The metatable is created in luaopen_crc64, so it just needs to be set here */
+static int push_crc(lua_State* const L, uint64_t const crc) {
+    uint64_t* const self = lua_newuserdata(L, sizeof(*self));
+    *self = crc;
 
-    lua_setmetatable(L, -2);
+    luaL_setmetatable(L, CRC64_MT);
     return 1;
 }
 
+static void check_raw(lua_State* const L) {
+    if (sizeof(lua_Integer) < sizeof(uint64_t)) {
+        luaL_error(L, "raw CRCs need 64-bit integers");
+    }
+}
+
 static int l_create(lua_State* const L) {
     uint64_t const high = luaL_checkinteger(L, 1) & UINT32_C(0xffffffff);
     uint64_t const low = luaL_checkinteger(L, 2) & UINT32_C(0xffffffff);
@@ -250,22 +2648,325 @@ static int l_compute(lua_State* const L) {
     return push_crc(L, crc);
 }
 
+#ifdef CRC64_MMAP
+#define CRC64_MAX_THREADS 64
+#define CRC64_MIN_CHUNK (1 << 20)
+
+typedef struct {
+    uint8_t const* data;
+    size_t nbytes;
+    uint64_t crc;
+}
+Chunk;
+
+static void* chunk_worker(void* const arg) {
+    Chunk* const chunk = (Chunk*)arg;
+    chunk->crc = crc64(chunk->data, chunk->nbytes);
+    return NULL;
+}
+
+static int l_file(lua_State* const L) {
+    char const* const path = luaL_checkstring(L, 1);
+    lua_Integer threads = luaL_optinteger(L, 2, 0);
+
+    luaL_argcheck(L, threads >= 0, 2, "number of threads must be non-negative");
+
+    if (threads == 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        threads = threads < 1 ? 1 : threads;
+    }
+
+    int const fd = open(path, O_RDONLY);
+
+    if (fd < 0) {
+        goto error;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0) {
+        int const saved = errno;
+        close(fd);
+        errno = saved;
+        goto error;
+    }
+
+    size_t const nbytes = (size_t)st.st_size;
+
+    if (nbytes == 0) {
+        close(fd);
+        return push_crc(L, crc64(NULL, 0));
+    }
+
+    void* const map = mmap(NULL, nbytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    int const saved = errno;
+    close(fd);
+
+    if (map == MAP_FAILED) {
+        errno = saved;
+        goto error;
+    }
+
+    posix_madvise(map, nbytes, POSIX_MADV_SEQUENTIAL);
+
+    /* Don't spawn threads for chunks that would be too small to pay off */
+    size_t count = nbytes / CRC64_MIN_CHUNK;
+    count = count < 1 ? 1 : count;
+    count = count > (size_t)threads ? (size_t)threads : count;
+    count = count > CRC64_MAX_THREADS ? CRC64_MAX_THREADS : count;
+
+    Chunk chunks[CRC64_MAX_THREADS];
+    pthread_t workers[CRC64_MAX_THREADS];
+    int started[CRC64_MAX_THREADS];
+    size_t const chunk_size = nbytes / count;
+
+    for (size_t i = 0; i < count; i++) {
+        chunks[i].data = (uint8_t const*)map + i * chunk_size;
+        chunks[i].nbytes = i == count - 1 ? nbytes - i * chunk_size : chunk_size;
+    }
+
+    /* The calling thread processes the last chunk */
+    for (size_t i = 0; i < count - 1; i++) {
+        started[i] = pthread_create(&workers[i], NULL, chunk_worker, &chunks[i]) == 0;
+
+        if (!started[i]) {
+            chunk_worker(&chunks[i]);
+        }
+    }
+
+    chunk_worker(&chunks[count - 1]);
+
+    for (size_t i = 0; i < count - 1; i++) {
+        if (started[i]) {
+            pthread_join(workers[i], NULL);
+        }
+    }
+
+    munmap(map, nbytes);
+
+    uint64_t crc = chunks[0].crc;
+
+    for (size_t i = 1; i < count; i++) {
+        crc = crc64_combine(crc, chunks[i].crc, chunks[i].nbytes);
+    }
+
+    return push_crc(L, crc);
+
+error:
+    lua_pushnil(L);
+    lua_pushfstring(L, "%s: %s", path, strerror(errno));
+    return 2;
+}
+#else
+static int l_file(lua_State* const L) {
+    char const* const path = luaL_checkstring(L, 1);
+    FILE* const file = fopen(path, "rb");
+
+    if (file == NULL) {
+        lua_pushnil(L);
+        lua_pushfstring(L, "%s: %s", path, strerror(errno));
+        return 2;
+    }
+
+    uint64_t cs = UINT64_C(0xffffffffffffffff);
+    uint8_t buffer[65536];
+    size_t nbytes = 0;
+
+    while ((nbytes = fread(buffer, 1, sizeof(buffer), file)) != 0) {
+        cs = update(cs, buffer, nbytes);
+    }
+
+    if (ferror(file)) {
+        fclose(file);
+        lua_pushnil(L);
+        lua_pushfstring(L, "%s: read error", path);
+        return 2;
+    }
+
+    fclose(file);
+    return push_crc(L, cs ^ UINT64_C(0xffffffffffffffff));
+}
+#endif
+
+static int l_compute_raw(lua_State* const L) {
+    size_t length = 0;
+    char const* const string = luaL_checklstring(L, 1, &length);
+
+    check_raw(L);
+
+    lua_pushinteger(L, (lua_Integer)crc64((void const*)string, length));
+    return 1;
+}
+
+static int l_compute_many(lua_State* const L) {
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int const raw = lua_toboolean(L, 2);
+
+    if (raw) {
+        check_raw(L);
+    }
+
+    lua_Integer const count = luaL_len(L, 1);
+    lua_createtable(L, count < INT32_MAX ? (int)count : INT32_MAX, 0);
+
+    for (lua_Integer i = 1; i <= count; i++) {
+        lua_rawgeti(L, 1, i);
+
+        size_t length = 0;
+        char const* const string = lua_tolstring(L, -1, &length);
+
+        if (string == NULL) {
+            return luaL_error(L, "element %I is not a string", i);
+        }
+
+        uint64_t const crc = crc64((void const*)string, length);
+        lua_pop(L, 1);
+
+        if (raw) {
+            lua_pushinteger(L, (lua_Integer)crc);
+        }
+        else {
+            push_crc(L, crc);
+        }
+
+        lua_rawseti(L, -2, i);
+    }
+
+    return 1;
+}
+
+static int l_chunks(lua_State* const L) {
+    size_t length = 0;
+    uint8_t const* const data = (uint8_t const*)luaL_checklstring(L, 1, &length);
+    lua_Integer const window = luaL_checkinteger(L, 2);
+    uint64_t const mask = (uint64_t)luaL_checkinteger(L, 3);
+    lua_Integer const min_size = luaL_optinteger(L, 4, window);
+    lua_Integer const max_size = luaL_optinteger(L, 5, 0);
+
+    luaL_argcheck(L, window > 0, 2, "window size must be positive");
+    luaL_argcheck(L, min_size >= 0, 4, "minimum chunk size must be non-negative");
+    luaL_argcheck(L, max_size >= 0, 5, "maximum chunk size must be non-negative");
+
+    /* out[b] cancels byte b when it leaves the window, b * x^(8 * window) */
+    uint64_t const shift = x2nmodp((uint64_t)window, 3);
+    uint64_t out[256];
+
+    for (int b = 0; b < 256; b++) {
+        out[b] = multmodp(shift, table[b]);
+    }
+
+    lua_newtable(L);
+    lua_Integer count = 0;
+
+    size_t const w = (size_t)window;
+    size_t const min = (size_t)min_size;
+    size_t const max = (size_t)max_size;
+    size_t start = 0;
+    uint64_t cs = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        cs = table[(cs ^ data[i]) & 0xff] ^ (cs >> 8);
+
+        if (i >= w) {
+            cs ^= out[data[i - w]];
+        }
+
+        size_t const size = i + 1 - start;
+
+        if ((size >= min && (cs & mask) == 0) || size == max) {
+            lua_pushinteger(L, (lua_Integer)(i + 1));
+            lua_rawseti(L, -2, ++count);
+            start = i + 1;
+        }
+    }
+
+    if (start < length) {
+        lua_pushinteger(L, (lua_Integer)length);
+        lua_rawseti(L, -2, ++count);
+    }
+
+    return 1;
+}
+
+static int l_combine(lua_State* const L) {
+    uint64_t const* const crc_a = luaL_checkudata(L, 1, CRC64_MT);
+    uint64_t const* const crc_b = luaL_checkudata(L, 2, CRC64_MT);
+    lua_Integer const length_b = luaL_checkinteger(L, 3);
+
+    luaL_argcheck(L, length_b >= 0, 3, "length must be non-negative");
+
+    return push_crc(L, crc64_combine(*crc_a, *crc_b, (size_t)length_b));
+}
+
+static int l_update(lua_State* const L) {
+    uint64_t* const self = luaL_checkudata(L, 1, CRC64_STATE_MT);
+    size_t length = 0;
+    char const* const string = luaL_checklstring(L, 2, &length);
+
+    *self = update(*self, (uint8_t const*)string, length);
+
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int l_finish(lua_State* const L) {
+    uint64_t const* const self = luaL_checkudata(L, 1, CRC64_STATE_MT);
+    return push_crc(L, *self ^ UINT64_C(0xffffffffffffffff));
+}
+
+static void push_state_metatable(lua_State* const L) {
+    if (luaL_newmetatable(L, CRC64_STATE_MT)) {
+        static luaL_Reg const methods[] = {
+            {"update", l_update},
+            {"finish", l_finish},
+            {NULL,     NULL}
+        };
+
+        luaL_newlib(L, methods);
+        lua_setfield(L, -2, "__index");
+
+        lua_pushliteral(L, "crc64.state");
+        lua_setfield(L, -2, "__name");
+    }
+}
+
+/* The metatable is created in luaopen_crc64, so it just needs to be set here */
+static int l_new(lua_State* const L) {
+    uint64_t* const self = lua_newuserdata(L, sizeof(*self));
+    *self = UINT64_C(0xffffffffffffffff);
+
+    luaL_setmetatable(L, CRC64_STATE_MT);
+    return 1;
+}
+
 LUAMOD_API int luaopen_crc64(lua_State* L) {
     static luaL_Reg const functions[] = {
         {"create", l_create},
         {"compute", l_compute},
+        {"compute_raw", l_compute_raw},
+        {"compute_many", l_compute_many},
+        {"new", l_new},
+        {"combine", l_combine},
+        {"file", l_file},
+        {"chunks", l_chunks},
         {NULL,  NULL}
     };
 
     static struct {char const* const name; char const* const value;} const info[] = {
         {"_COPYRIGHT", "Copyright (c) 2022 Andre Leiradella"},
         {"_LICENSE", "MIT"},
-        {"_VERSION", "1.0.0"},
+        {"_VERSION", "1.1.0"},
         {"_NAME", "crc64"},
         {"_URL", "https://github.com/leiradel/luamods/crc64"},
         {"_DESCRIPTION", "Computes the CRC-64 (ECMA 182) of a given string"}
     };
 
+    push_metatable(L);
+    push_state_metatable(L);
+    lua_pop(L, 2);
+
     size_t const functions_count = sizeof(functions) / sizeof(functions[0]) - 1;
     size_t const info_count = sizeof(info) / sizeof(info[0]);
 
@@ -0,0 +1,61 @@
+local crc64 = require 'crc64'
+
+local function bench(name, count, func)
+    collectgarbage()
+    collectgarbage()
+
+    local t0 = os.clock()
+    func()
+    local elapsed = os.clock() - t0
+
+    print(string.format('%-16s %13.1f', name, elapsed * 1e9 / count))
+end
+
+-------------------------------------------------------------------------------
+-- Generate many small keys
+
+local count = 1000000
+local keys = {}
+
+for i = 1, count do
+    keys[i] = string.format('key:%08x', i)
+end
+
+-------------------------------------------------------------------------------
+-- Check that all paths agree
+
+local many = crc64.compute_many(keys)
+local many_raw = crc64.compute_many(keys, true)
+
+for i = 1, 1000 do
+    local crc = crc64.compute(keys[i])
+    assert(many[i] == crc)
+    assert(string.format('0x%016x', many_raw[i]) == tostring(crc))
+    assert(crc64.compute_raw(keys[i]) == many_raw[i])
+end
+
+-------------------------------------------------------------------------------
+-- Benchmark
+
+print(string.format('%s, %d keys of %d bytes', _VERSION, count, #keys[1]))
+print(string.format('%-16s %13s', 'function', 'ns/key'))
+
+bench('compute', count, function()
+    for i = 1, count do
+        local crc = crc64.compute(keys[i])
+    end
+end)
+
+bench('compute_raw', count, function()
+    for i = 1, count do
+        local crc = crc64.compute_raw(keys[i])
+    end
+end)
+
+bench('compute_many', count, function()
+    local crcs = crc64.compute_many(keys)
+end)
+
+bench('compute_many raw', count, function()
+    local crcs = crc64.compute_many(keys, true)
+end)
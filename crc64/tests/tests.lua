@@ -0,0 +1,252 @@
+local crc64 = require 'crc64'
+
+-- CRC of the first n bytes of data for all n, one byte at a time.
+local function reference(data)
+    local table = {}
+
+    for i = 0, 255 do
+        local cs = i
+
+        for j = 1, 8 do
+            cs = (cs >> 1) ~ ((cs & 1) ~= 0 and 0xc96c5795d7870f42 or 0)
+        end
+
+        table[i] = cs
+    end
+
+    local crcs = {[0] = 0}
+    local cs = -1
+
+    for i = 1, #data do
+        cs = table[(cs ~ data:byte(i)) & 0xff] ~ (cs >> 8)
+        crcs[i] = ~cs
+    end
+
+    return crcs
+end
+
+local function tocrc(raw)
+    return crc64.create(raw >> 32, raw & 0xffffffff)
+end
+
+-------------------------------------------------------------------------------
+-- Check value
+
+assert(tostring(crc64.compute('123456789')) == '0x995dc9bbdf1939fa')
+assert(crc64.compute_raw('123456789') == 0x995dc9bbdf1939fa)
+assert(crc64.compute('') == crc64.create(0, 0))
+
+-------------------------------------------------------------------------------
+-- Kernels against the reference
+
+local data = {}
+
+for i = 1, 4200 do
+    data[i] = string.char((i * 2654435761 >> 13) & 255)
+end
+
+data = table.concat(data)
+local expected = reference(data)
+
+local lengths = {}
+
+-- Slice-by-16 and the 16-byte tails of the folding kernels.
+for n = 0, 300 do lengths[#lengths + 1] = n end
+
+-- 128-byte folding starts at 256 bytes, 256-byte folding starts at 1024.
+for n = 1000, 1100 do lengths[#lengths + 1] = n end
+for n = 2030, 2070 do lengths[#lengths + 1] = n end
+for n = 4080, 4200 do lengths[#lengths + 1] = n end
+
+for _, n in ipairs(lengths) do
+    local s = data:sub(1, n)
+    assert(crc64.compute_raw(s) == expected[n], n)
+    assert(crc64.compute(s) == tocrc(expected[n]), n)
+end
+
+-------------------------------------------------------------------------------
+-- Incremental updates
+
+-- Splitting the input makes the kernels start at offsets that aren't multiples
+-- of their block sizes, with a non-initial CRC in the first block.
+for _, n in ipairs{255, 256, 257, 300, 1023, 1024, 1025, 1100, 2048, 2070, 4200} do
+    for split = 0, 33 do
+        local state = crc64.new()
+        state:update(data:sub(1, split)):update(data:sub(split + 1, n))
+        assert(state:finish() == tocrc(expected[n]), n .. ' split at ' .. split)
+    end
+end
+
+-------------------------------------------------------------------------------
+-- Combine
+
+for _, split in ipairs{0, 1, 15, 16, 17, 255, 256, 1024, 3000, 4200} do
+    local a = crc64.compute(data:sub(1, split))
+    local b = crc64.compute(data:sub(split + 1))
+    assert(crc64.combine(a, b, #data - split) == tocrc(expected[#data]), split)
+end
+
+-------------------------------------------------------------------------------
+-- Many
+
+local many = crc64.compute_many({'', '123456789', data}, true)
+assert(many[1] == 0 and many[2] == 0x995dc9bbdf1939fa and many[3] == expected[#data])
+
+-------------------------------------------------------------------------------
+-- Files
+
+do
+    local path = os.tmpname()
+
+    local function write(contents)
+        local file = assert(io.open(path, 'wb'))
+        assert(file:write(contents))
+        file:close()
+    end
+
+    -- Empty, under 1 MiB so it's done in one go, and several MiB split between
+    -- threads and combined.
+    local big = data:rep(5 * 1024 * 1024 // #data + 1)
+
+    for _, contents in ipairs{'', data, big} do
+        write(contents)
+        local expected = crc64.compute(contents)
+
+        for _, threads in ipairs{1, 2, 3, 4, 64} do
+            assert(crc64.file(path, threads) == expected, #contents .. ' with ' .. threads .. ' threads')
+        end
+
+        assert(crc64.file(path) == expected)
+    end
+
+    os.remove(path)
+
+    local crc, err = crc64.file(path)
+    assert(crc == nil and err:sub(1, #path + 2) == path .. ': ')
+    assert(not pcall(crc64.file, path, -1))
+end
+
+-------------------------------------------------------------------------------
+-- Chunks
+
+do
+    local crcs = {}
+
+    for i = 0, 255 do
+        local cs = i
+
+        for j = 1, 8 do
+            cs = (cs >> 1) ~ ((cs & 1) ~= 0 and 0xc96c5795d7870f42 or 0)
+        end
+
+        crcs[i] = cs
+    end
+
+    -- Chunks computed with the CRC of each window from scratch.
+    local function chunks(s, window, mask, min, max)
+        min = min or window
+        max = max or 0
+        local result = {}
+        local start = 0
+
+        for i = 1, #s do
+            local cs = 0
+
+            for j = math.max(1, i - window + 1), i do
+                cs = crcs[(cs ~ s:byte(j)) & 0xff] ~ (cs >> 8)
+            end
+
+            local size = i - start
+
+            if (size >= min and cs & mask == 0) or size == max then
+                result[#result + 1] = i
+                start = i
+            end
+        end
+
+        if start < #s then
+            result[#result + 1] = #s
+        end
+
+        return result
+    end
+
+    local function same(a, b)
+        if #a ~= #b then
+            return false
+        end
+
+        for i = 1, #a do
+            if a[i] ~= b[i] then
+                return false
+            end
+        end
+
+        return true
+    end
+
+    local bytes = {}
+    local seed = 1
+
+    for i = 1, 20000 do
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        bytes[i] = string.char(seed >> 16 & 255)
+    end
+
+    local s = table.concat(bytes)
+
+    -- Against the reference, and the same every time.
+    for _, args in ipairs{{16, 0x3f}, {16, 0x3f, 0}, {16, 0x3f, 100, 300}, {7, 0xff, 1, 64}, {48, 0x1f, 2, 0}} do
+        local result = crc64.chunks(s, table.unpack(args))
+        assert(#result > 10)
+        assert(same(result, chunks(s, table.unpack(args))))
+        assert(same(result, crc64.chunks(s, table.unpack(args))))
+    end
+
+    -- The limits hold for all chunks but the last, which can be smaller than min.
+    local min, max = 100, 300
+    local start = 0
+    local result = crc64.chunks(s, 16, 0x3f, min, max)
+
+    for i, finish in ipairs(result) do
+        assert(finish - start <= max)
+        assert(finish - start >= min or i == #result)
+        start = finish
+    end
+
+    assert(result[#result] == #s)
+
+    -- Inserting a byte only moves the boundaries near it, the ones after are shifted by one.
+    local inserted = s:sub(1, 10000) .. 'x' .. s:sub(10001)
+    local before, after = crc64.chunks(s, 16, 0x3f), crc64.chunks(inserted, 16, 0x3f)
+    local kept, shifted = {}, {}
+
+    for _, finish in ipairs(after) do
+        kept[finish] = true
+        shifted[finish - 1] = true
+    end
+
+    local moved = 0
+
+    for _, finish in ipairs(before) do
+        if finish < 10000 then
+            assert(kept[finish])
+        elseif not shifted[finish] then
+            assert(finish < 10000 + 64, finish)
+            moved = moved + 1
+        end
+    end
+
+    assert(moved <= 2)
+
+    -- Inputs shorter than the window.
+    assert(same(crc64.chunks('', 16, 0), {}))
+    assert(same(crc64.chunks('abc', 16, 0x3f), {3}))
+    assert(same(crc64.chunks('abc', 16, 0, 1), {1, 2, 3}))
+    assert(same(crc64.chunks('abc', 16, 0x3f, 1), chunks('abc', 16, 0x3f, 1)))
+    assert(same(crc64.chunks('abcdef', 16, -1, 0, 2), {2, 4, 6}))
+
+    assert(not pcall(crc64.chunks, s, 0, 0))
+    assert(not pcall(crc64.chunks, s, 16, 0, -1))
+    assert(not pcall(crc64.chunks, s, 16, 0, 0, -1))
+end
@@ -1,23 +1,215 @@
+#ifndef WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include <lua.h>
 #include <lauxlib.h>
 
 #include <curl/curl.h>
 
-#ifndef WIN32
+#ifdef WIN32
+#include <windows.h>
+#else
 #include <unistd.h>
+#include <time.h>
 #endif
 
+#include <limits.h>
 #include <stdlib.h>
 
 static CURLM* cm;
 
+/* How requests are driven, perform and socket_action can't be mixed on the same multi handle */
+typedef enum {
+    MODE_NONE,
+    MODE_PERFORM,  /* http.tick and http.wait */
+    MODE_SOCKET    /* http.on_socket and http.on_timeout */
+}
+Mode;
+
+static Mode mode = MODE_NONE;
+
+/* DNS, TLS sessions, connections and cookies shared by all requests, kept alive while requests use it */
+typedef struct {
+    CURLSH* handle;
+    unsigned users;
+}
+Share;
+
+static Share* share;
+static long dns_cache_timeout = 60;
+
 typedef struct {
     lua_State* L;
     int cb_ref;
+    CURL* handle;
+    Share* share;
     char error[CURL_ERROR_SIZE];
 }
 UserData;
 
+static Share* new_share(void) {
+    Share* const self = (Share*)malloc(sizeof(*self));
+
+    if (self == NULL) {
+        return NULL;
+    }
+
+    self->handle = curl_share_init();
+
+    if (self->handle == NULL) {
+        free(self);
+        return NULL;
+    }
+
+    static curl_lock_data const data[] = {
+        CURL_LOCK_DATA_DNS, CURL_LOCK_DATA_SSL_SESSION, CURL_LOCK_DATA_CONNECT, CURL_LOCK_DATA_COOKIE
+    };
+
+    for (size_t i = 0; i < sizeof(data) / sizeof(data[0]); i++) {
+        if (curl_share_setopt(self->handle, CURLSHOPT_SHARE, data[i]) != CURLSHE_OK) {
+            curl_share_cleanup(self->handle);
+            free(self);
+            return NULL;
+        }
+    }
+
+    self->users = 0;
+    return self;
+}
+
+static void detach_share(UserData* const ud) {
+    Share* const old = ud->share;
+
+    if (old != NULL) {
+        curl_easy_setopt(ud->handle, CURLOPT_SHARE, NULL);
+        ud->share = NULL;
+
+        // Shares replaced by http.flush are only destroyed when their last request finishes.
+        if (--old->users == 0 && old != share) {
+            curl_share_cleanup(old->handle);
+            free(old);
+        }
+    }
+}
+
+/* Finished requests are kept here to reuse their easy handles, connections are cached by the multi handle */
+#define MAX_POOL_SIZE 256
+
+static UserData* pool[MAX_POOL_SIZE];
+static size_t pool_count = 0;
+static size_t pool_size = 16;
+
+static UserData* acquire(void) {
+    if (pool_count != 0) {
+        return pool[--pool_count];
+    }
+
+    UserData* const ud = (UserData*)malloc(sizeof(*ud));
+
+    if (ud == NULL) {
+        return NULL;
+    }
+
+    ud->handle = curl_easy_init();
+
+    if (ud->handle == NULL) {
+        free(ud);
+        return NULL;
+    }
+
+    ud->share = NULL;
+    return ud;
+}
+
+static void release(UserData* const ud) {
+    detach_share(ud);
+
+    if (pool_count < pool_size) {
+        // Only the options are reset, the handle is ready to be set up for a new request.
+        curl_easy_reset(ud->handle);
+        pool[pool_count++] = ud;
+        return;
+    }
+
+    curl_easy_cleanup(ud->handle);
+    free(ud);
+}
+
+/* Sockets libcurl wants watched, and for which events, kept up to date by socket_cb */
+typedef struct {
+    curl_socket_t fd;
+    int what;
+}
+Socket;
+
+static Socket* sockets = NULL;
+static size_t socket_count = 0;
+static size_t socket_capacity = 0;
+
+static int socket_cb(CURL* easy, curl_socket_t fd, int what, void* userp, void* socketp) {
+    (void)easy;
+    (void)userp;
+    (void)socketp;
+
+    size_t i = 0;
+
+    while (i < socket_count && sockets[i].fd != fd) {
+        i++;
+    }
+
+    if (what == CURL_POLL_REMOVE) {
+        if (i < socket_count) {
+            sockets[i] = sockets[--socket_count];
+        }
+
+        return 0;
+    }
+
+    if (i == socket_count) {
+        if (socket_count == socket_capacity) {
+            size_t const capacity = socket_capacity == 0 ? 16 : socket_capacity * 2;
+            Socket* const grown = (Socket*)realloc(sockets, capacity * sizeof(*grown));
+
+            if (grown == NULL) {
+                return -1;
+            }
+
+            sockets = grown;
+            socket_capacity = capacity;
+        }
+
+        sockets[socket_count++].fd = fd;
+    }
+
+    sockets[i].what = what;
+    return 0;
+}
+
+/* When libcurl wants http.on_timeout to be called, in milliseconds of now_ms, kept up to date by timer_cb */
+static long long deadline = 0;
+static int has_deadline = 0;
+
+static long long now_ms(void) {
+#ifdef WIN32
+    return (long long)GetTickCount64();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+}
+
+static int timer_cb(CURLM* multi, long timeout_ms, void* userp) {
+    (void)multi;
+    (void)userp;
+
+    // -1 deletes the timer, 0 asks for http.on_timeout to be called as soon as possible.
+    has_deadline = timeout_ms >= 0;
+    deadline = has_deadline ? now_ms() + timeout_ms : 0;
+    return 0;
+}
+
 static size_t header_cb(char* ptr, size_t size, size_t nmemb, void* userdata) {
     UserData const* const ud = (UserData*)userdata;
     size_t const bytes = size * nmemb;
@@ -61,36 +253,49 @@ static int l_get(lua_State* const L) {
 
     lua_pushvalue(L, 2);
 
-    UserData* ud = (UserData*)malloc(sizeof(*ud));
+    UserData* ud = acquire();
 
     if (ud == NULL) {
-        return luaL_error(L, "out of memory");
-    }
-
-    CURL* handle = curl_easy_init();
-
-    if (handle == NULL) {
         return luaL_error(L, "error creating easy handle");
     }
 
+    CURL* const handle = ud->handle;
     CURLcode const res1 = curl_easy_setopt(handle, CURLOPT_URL, url);
 
     if (res1 != CURLE_OK) {
+        release(ud);
         return luaL_error(L, "%s", curl_easy_strerror(res1));
     }
 
     // Those will always succeed
-    curl_easy_setopt(handle, CURLOPT_HTTPGET, 1);
+    curl_easy_setopt(handle, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+    curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
     curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, header_cb);
     curl_easy_setopt(handle, CURLOPT_HEADERDATA, ud);
     curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, write_cb);
     curl_easy_setopt(handle, CURLOPT_WRITEDATA, ud);
     curl_easy_setopt(handle, CURLOPT_PRIVATE, ud);
     curl_easy_setopt(handle, CURLOPT_ERRORBUFFER, ud->error);
+    curl_easy_setopt(handle, CURLOPT_DNS_CACHE_TIMEOUT, dns_cache_timeout);
+
+    // An empty file name enables the cookie engine without reading cookies from disk.
+    curl_easy_setopt(handle, CURLOPT_COOKIEFILE, "");
+
+    CURLcode const res3 = curl_easy_setopt(handle, CURLOPT_SHARE, share->handle);
+
+    if (res3 != CURLE_OK) {
+        release(ud);
+        return luaL_error(L, "%s", curl_easy_strerror(res3));
+    }
+
+    ud->share = share;
+    share->users++;
 
     CURLMcode const res2 = curl_multi_add_handle(cm, handle);
 
     if (res2 != CURLM_OK) {
+        release(ud);
         return luaL_error(L, "%s", curl_multi_strerror(res2));
     }
 
@@ -100,10 +305,7 @@ static int l_get(lua_State* const L) {
     return 0;
 }
 
-static int l_tick(lua_State* const L) {
-    int still_alive = 0;
-    curl_multi_perform(cm, &still_alive);
-
+static void dispatch(lua_State* const L) {
     for (;;) {
         int msgs_left = 0;
         CURLMsg* const msg = curl_multi_info_read(cm, &msgs_left);
@@ -115,7 +317,7 @@ static int l_tick(lua_State* const L) {
         CURL* const handle = msg->easy_handle;
         char* private = NULL;
         curl_easy_getinfo(handle, CURLINFO_PRIVATE, &private);
-        UserData const* const ud = (UserData*)private;
+        UserData* const ud = (UserData*)private;
 
         lua_rawgeti(L, LUA_REGISTRYINDEX, ud->cb_ref);
 
@@ -137,17 +339,202 @@ static int l_tick(lua_State* const L) {
         }
 
         luaL_unref(L, LUA_REGISTRYINDEX, ud->cb_ref);
-        free((void*)ud);
 
         curl_multi_remove_handle(cm, handle);
-        curl_easy_cleanup(handle);
+        release(ud);
+    }
+}
+
+static void set_mode(lua_State* const L, Mode const wanted) {
+    if (mode != wanted && mode != MODE_NONE) {
+        luaL_error(L, "http.tick and http.wait can't be mixed with http.on_socket and http.on_timeout");
+    }
+
+    mode = wanted;
+}
+
+static int l_tick(lua_State* const L) {
+    set_mode(L, MODE_PERFORM);
+
+    int still_alive = 0;
+    curl_multi_perform(cm, &still_alive);
+    dispatch(L);
+    return 0;
+}
+
+static int l_wait(lua_State* const L) {
+    lua_Integer const timeout_ms = luaL_checkinteger(L, 1);
+    luaL_argcheck(L, timeout_ms >= 0 && timeout_ms <= INT_MAX, 1, "invalid timeout");
+    set_mode(L, MODE_PERFORM);
+
+    // Sleeps until there's activity on the sockets or libcurl has a timeout to handle.
+    CURLMcode const res = curl_multi_poll(cm, NULL, 0, (int)timeout_ms, NULL);
+
+    if (res != CURLM_OK) {
+        return luaL_error(L, "%s", curl_multi_strerror(res));
+    }
+
+    int still_alive = 0;
+    curl_multi_perform(cm, &still_alive);
+    dispatch(L);
+    return 0;
+}
+
+static int l_on_socket(lua_State* const L) {
+    curl_socket_t const fd = (curl_socket_t)luaL_checkinteger(L, 1);
+    char const* events = luaL_optstring(L, 2, "");
+    int mask = 0;
+
+    for (; *events != 0; events++) {
+        switch (*events) {
+            case 'r': mask |= CURL_CSELECT_IN; break;
+            case 'w': mask |= CURL_CSELECT_OUT; break;
+            case 'e': mask |= CURL_CSELECT_ERR; break;
+            default: return luaL_argerror(L, 2, "events must only contain 'r', 'w', and 'e'");
+        }
+    }
+
+    set_mode(L, MODE_SOCKET);
+
+    int running = 0;
+    CURLMcode const res = curl_multi_socket_action(cm, fd, mask, &running);
+
+    if (res != CURLM_OK) {
+        return luaL_error(L, "%s", curl_multi_strerror(res));
+    }
+
+    dispatch(L);
+    return 0;
+}
+
+static int l_on_timeout(lua_State* const L) {
+    set_mode(L, MODE_SOCKET);
+
+    // The timer fires once, timer_cb sets a new deadline if libcurl needs one.
+    has_deadline = 0;
+
+    int running = 0;
+    CURLMcode const res = curl_multi_socket_action(cm, CURL_SOCKET_TIMEOUT, 0, &running);
+
+    if (res != CURLM_OK) {
+        return luaL_error(L, "%s", curl_multi_strerror(res));
+    }
+
+    dispatch(L);
+    return 0;
+}
+
+static int l_sockets(lua_State* const L) {
+    static char const* const events[] = {"", "r", "w", "rw"};
+
+    lua_createtable(L, 0, socket_count);
+
+    for (size_t i = 0; i < socket_count; i++) {
+        lua_pushstring(L, events[sockets[i].what & CURL_POLL_INOUT]);
+        lua_rawseti(L, -2, (lua_Integer)sockets[i].fd);
+    }
+
+    return 1;
+}
+
+static int l_timeout(lua_State* const L) {
+    if (!has_deadline) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    long long const left = deadline - now_ms();
+    lua_pushinteger(L, left > 0 ? (lua_Integer)left : 0);
+    return 1;
+}
+
+static void set_multi_option(lua_State* const L, char const* const name, CURLMoption const option) {
+    if (lua_getfield(L, 1, name) != LUA_TNIL) {
+        CURLMcode const res = curl_multi_setopt(cm, option, (long)luaL_checkinteger(L, -1));
+
+        if (res != CURLM_OK) {
+            luaL_error(L, "%s: %s", name, curl_multi_strerror(res));
+        }
+    }
+
+    lua_pop(L, 1);
+}
+
+static int l_configure(lua_State* const L) {
+    luaL_checktype(L, 1, LUA_TTABLE);
+
+    set_multi_option(L, "max_host_connections", CURLMOPT_MAX_HOST_CONNECTIONS);
+    set_multi_option(L, "max_total_connections", CURLMOPT_MAX_TOTAL_CONNECTIONS);
+    set_multi_option(L, "max_connects", CURLMOPT_MAXCONNECTS);
+
+    if (lua_getfield(L, 1, "multiplex") != LUA_TNIL) {
+        long const pipelining = lua_toboolean(L, -1) ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING;
+        CURLMcode const res = curl_multi_setopt(cm, CURLMOPT_PIPELINING, pipelining);
+
+        if (res != CURLM_OK) {
+            return luaL_error(L, "multiplex: %s", curl_multi_strerror(res));
+        }
+    }
+
+    lua_pop(L, 1);
+
+    if (lua_getfield(L, 1, "dns_cache_timeout") != LUA_TNIL) {
+        dns_cache_timeout = (long)luaL_checkinteger(L, -1);
+    }
+
+    lua_pop(L, 1);
+
+    if (lua_getfield(L, 1, "pool_size") != LUA_TNIL) {
+        lua_Integer const size = luaL_checkinteger(L, -1);
+        luaL_argcheck(L, size >= 0 && size <= MAX_POOL_SIZE, 1, "pool_size must be between 0 and 256");
+        pool_size = (size_t)size;
+
+        // Free the handles that don't fit in the new size.
+        while (pool_count > pool_size) {
+            UserData* const ud = pool[--pool_count];
+            curl_easy_cleanup(ud->handle);
+            free(ud);
+        }
+    }
+
+    lua_pop(L, 1);
+    return 0;
+}
+
+static int l_flush(lua_State* const L) {
+    Share* const fresh = new_share();
+
+    if (fresh == NULL) {
+        return luaL_error(L, "error creating share handle");
+    }
+
+    Share* const old = share;
+    share = fresh;
+
+    // Requests already running keep the old share until they finish.
+    if (old->users == 0) {
+        curl_share_cleanup(old->handle);
+        free(old);
     }
 
     return 0;
 }
 
 static int l_cleanup(lua_State* const L) {
+    while (pool_count != 0) {
+        UserData* const ud = pool[--pool_count];
+        curl_easy_cleanup(ud->handle);
+        free(ud);
+    }
+
     curl_multi_cleanup(cm);
+    free(sockets);
+
+    if (share->users == 0) {
+        curl_share_cleanup(share->handle);
+        free(share);
+    }
+
     curl_global_cleanup();
     return 0;
 }
@@ -156,13 +543,20 @@ LUAMOD_API int luaopen_http(lua_State* const L) {
     static const luaL_Reg functions[] = {
         {"get", l_get},
         {"tick", l_tick},
+        {"wait", l_wait},
+        {"configure", l_configure},
+        {"flush", l_flush},
+        {"on_socket", l_on_socket},
+        {"on_timeout", l_on_timeout},
+        {"sockets", l_sockets},
+        {"timeout", l_timeout},
         {NULL, NULL}
     };
 
     static struct {char const* const name; char const* const value;} const info[] = {
         {"_COPYRIGHT", "Copyright (c) 2022 Andre Leiradella"},
         {"_LICENSE", "MIT"},
-        {"_VERSION", "1.0.0"},
+        {"_VERSION", "1.1.0"},
         {"_NAME", "http"},
         {"_URL", "https://github.com/leiradel/luamods/http"},
         {"_DESCRIPTION", "A module that performs non-blocking HTTP requests"}
@@ -181,6 +575,22 @@ LUAMOD_API int luaopen_http(lua_State* const L) {
         return luaL_error(L, "error creating the global multi handle");
     }
 
+    share = new_share();
+
+    if (share == NULL) {
+        curl_multi_cleanup(cm);
+        curl_global_cleanup();
+        return luaL_error(L, "error creating share handle");
+    }
+
+    // Send concurrent requests to the same host over a single HTTP/2 connection when possible.
+    curl_multi_setopt(cm, CURLMOPT_PIPELINING, (long)CURLPIPE_MULTIPLEX);
+
+    // Track the sockets in use and the timeout so event loops can drive transfers with
+    // http.on_socket and http.on_timeout.
+    curl_multi_setopt(cm, CURLMOPT_SOCKETFUNCTION, socket_cb);
+    curl_multi_setopt(cm, CURLMOPT_TIMERFUNCTION, timer_cb);
+
     size_t const functions_count = sizeof(functions) / sizeof(functions[0]) - 1;
     size_t const info_count = sizeof(info) / sizeof(info[0]);
 